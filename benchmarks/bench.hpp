@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef OXIDE_BENCH_HPP
+#define OXIDE_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+// Minimal timing harness shared by the benchmark targets (no external dependencies)
+namespace oxide::bench {
+    /**
+     * @brief Prevents the optimizer from discarding a computed value.
+     *
+     * @param value The value that must be treated as observed.
+     */
+    template <typename T>
+    inline void do_not_optimize(const T& value) {
+#if defined(_MSC_VER)
+        static volatile const void* sink;
+        sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /**
+     * @brief Measures a single call to `body`.
+     *
+     * @param body The callable to measure.
+     * @return The elapsed wall-clock time in nanoseconds.
+     */
+    template <typename F>
+    double elapsed_ns(F&& body) {
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        body();
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    }
+
+    /**
+     * @brief Prints one result line.
+     *
+     * @param name The label printed for this measurement.
+     * @param ns_per_op The time per operation in nanoseconds.
+     */
+    inline void report(const char* name, const double ns_per_op) {
+        std::printf("%-48s %10.3f ns/op\n", name, ns_per_op);
+    }
+
+    /**
+     * @brief Runs `body` for a number of repetitions and prints the best time per operation.
+     *
+     * @param name The label printed for this measurement.
+     * @param ops The number of logical operations performed by one call to `body`.
+     * @param body The callable to measure.
+     * @param repetitions How many times `body` is run; the fastest run is reported.
+     * @return The best observed time per operation in nanoseconds.
+     */
+    template <typename F>
+    double run(const char* name, const std::size_t ops, F&& body, const int repetitions = 7) {
+        double best = 0.0;
+        for (int r = 0; r < repetitions; ++r) {
+            const double elapsed = elapsed_ns(body);
+            if (r == 0 || elapsed < best) best = elapsed;
+        }
+        const double per_op = best / static_cast<double>(ops);
+        report(name, per_op);
+        return per_op;
+    }
+}  // namespace oxide::bench
+
+#endif // OXIDE_BENCH_HPP
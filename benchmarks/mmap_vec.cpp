@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <oxide/mmap_vec.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+
+#include "bench.hpp"
+
+struct Record {
+    std::uint64_t id;
+    double value;
+};
+
+int main() {
+    using namespace oxide;
+    constexpr size_t count = 1 << 22;  // 64 MiB of records
+    const auto path = std::filesystem::temp_directory_path() / "oxide_mmap_vec_bench.bin";
+
+    bench::run("Vec<Record>::push", count, [&] {
+        Vec<Record> vec;
+        for (size_t i = 0; i < count; ++i) vec.push({i, static_cast<double>(i)});
+        bench::do_not_optimize(vec.as_ptr());
+    }, 3);
+
+    bench::run("MmapVec<Record>::push (new file)", count, [&] {
+        std::filesystem::remove(path);
+        auto vec = MmapVec<Record>::open(path).value();
+        for (size_t i = 0; i < count; ++i) vec.push({i, static_cast<double>(i)});
+        bench::do_not_optimize(vec.as_ptr());
+    }, 3);
+
+    bench::run("MmapVec<Record>::flush (msync)", 1, [&] {
+        auto vec = MmapVec<Record>::open(path).value();
+        bench::do_not_optimize(vec.flush().has_value());
+    }, 1);
+
+    // Opening maps the file and checks the header, the cost does not depend on the length
+    bench::run("MmapVec<Record>::open (existing file)", 1, [&] {
+        auto vec = MmapVec<Record>::open(path).value();
+        bench::do_not_optimize(vec.len());
+    });
+
+    bench::run("MmapVec<Record> sum over as_slice()", count, [&] {
+        const auto vec = MmapVec<Record>::open(path).value();
+        double sum = 0.0;
+        for (const Record& record : vec.as_slice()) sum += record.value;
+        bench::do_not_optimize(sum);
+    });
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <oxide.hpp>
+
+#include <cstdint>
+#include <cstdio>
+
+#include "bench.hpp"
+
+struct Handle {
+    std::uint32_t id;
+};
+
+// Same payload, but None uses the reserved id instead of a separate flag
+struct NicheHandle {
+    std::uint32_t id;
+
+    friend constexpr bool operator==(const NicheHandle&, const NicheHandle&) = default;
+};
+
+template <>
+struct oxide::niche<NicheHandle> : oxide::sentinel_niche<NicheHandle, NicheHandle{~std::uint32_t{0}}> {};
+
+template <typename H>
+void scan(const char* name) {
+    using namespace oxide;
+    constexpr size_t count = 1 << 22;
+    Vec<Option<H>> table;
+    for (size_t i = 0; i < count; ++i) {
+        table.push(i % 3 == 0 ? Option<H>() : Option<H>(H{static_cast<std::uint32_t>(i)}));
+    }
+    bench::run(name, count, [&] {
+        std::uint64_t sum = 0;
+        for (const Option<H>& slot : table.as_slice()) {
+            if (slot.has_value()) sum += slot->id;
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+int main() {
+    std::printf("sizeof(Option<Handle>) = %zu, sizeof(Option<NicheHandle>) = %zu\n",
+                sizeof(oxide::Option<Handle>), sizeof(oxide::Option<NicheHandle>));
+    scan<Handle>("scan Vec<Option<Handle>> (flag)");
+    scan<NicheHandle>("scan Vec<Option<NicheHandle>> (niche)");
+    return 0;
+}
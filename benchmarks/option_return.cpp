@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <oxide.hpp>
+
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+#include "bench.hpp"
+
+// Codegen check for returning Option by value. With trivial copies and destruction, Option<int>
+// comes back in a register and Option<std::pair<int, int>> in two (GCC 12 still assembles the
+// 12-byte pair case on the stack first); LegacyOption mirrors the previous user-provided special
+// members and is returned through memory. Inspect with e.g.
+// `objdump -d --no-show-raw-insn oxide_option_return_bench | grep -A12 'find_'`.
+template <typename T>
+class LegacyOption {
+    alignas(T) unsigned char m_storage[sizeof(T)]{};
+    bool m_has_value = false;
+
+public:
+    LegacyOption() noexcept {}
+    explicit LegacyOption(const T& value) : m_has_value(true) { std::construct_at(ptr(), value); }
+    LegacyOption(const LegacyOption& other) : m_has_value(other.m_has_value) {
+        if (m_has_value) std::construct_at(ptr(), *other.ptr());
+    }
+    ~LegacyOption() {
+        if (m_has_value) std::destroy_at(ptr());
+    }
+
+    [[nodiscard]] bool has_value() const noexcept { return m_has_value; }
+    [[nodiscard]] const T& value() const noexcept { return *ptr(); }
+
+private:
+    T* ptr() noexcept { return reinterpret_cast<T*>(m_storage); }
+    const T* ptr() const noexcept { return reinterpret_cast<const T*>(m_storage); }
+};
+
+static_assert(std::is_trivially_copyable_v<oxide::Option<int>>);
+static_assert(!std::is_trivially_copyable_v<LegacyOption<int>>);
+
+template <template <typename> class Opt>
+OXIDE_NOINLINE Opt<int> find_int(const int* data, const size_t i) {
+    return data[i] >= 0 ? Opt<int>(data[i]) : Opt<int>();
+}
+
+template <template <typename> class Opt>
+OXIDE_NOINLINE Opt<std::pair<int, int>> find_pair(const int* data, const size_t i) {
+    return data[i] >= 0 ? Opt<std::pair<int, int>>(std::pair{data[i], static_cast<int>(i)}) : Opt<std::pair<int, int>>();
+}
+
+template <template <typename> class Opt>
+void run(const char* int_name, const char* pair_name, const oxide::Vec<int>& data) {
+    using namespace oxide;
+    bench::run(int_name, data.len(), [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < data.len(); ++i) {
+            const auto found = find_int<Opt>(data.as_ptr(), i);
+            if (found.has_value()) sum += found.value();
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run(pair_name, data.len(), [&] {
+        long long sum = 0;
+        for (size_t i = 0; i < data.len(); ++i) {
+            const auto found = find_pair<Opt>(data.as_ptr(), i);
+            if (found.has_value()) sum += found.value().first + found.value().second;
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+int main() {
+    using namespace oxide;
+    constexpr size_t count = 1 << 20;
+    Vec<int> data;
+    for (size_t i = 0; i < count; ++i) data.push(i % 5 == 0 ? -1 : static_cast<int>(i));
+
+    run<Option>("return Option<int>", "return Option<pair<int, int>>", data);
+    run<LegacyOption>("return LegacyOption<int>", "return LegacyOption<pair<int, int>>", data);
+    return 0;
+}
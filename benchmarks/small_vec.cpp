@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <memory>
+
+#include "bench.hpp"
+
+struct Quit {};
+struct Move { int x, y; };
+using Message = oxide::Union<Quit, Move>;
+using Handler = void (*)(const Message&);
+
+static void on_message(const Message& msg) { oxide::bench::do_not_optimize(msg.index()); }
+
+// SmallVec against Vec for short-lived, short handler lists
+template <typename V>
+static void measure(const char* construct, const char* push, const char* destroy) {
+    using namespace oxide;
+    constexpr size_t rounds = 1 << 18;
+    constexpr size_t handlers = 6;
+
+    // Construction alone (an empty list)
+    bench::run(construct, rounds, [&] {
+        for (size_t r = 0; r < rounds; ++r) {
+            V v;
+            bench::do_not_optimize(v);
+        }
+    });
+
+    // Construction, a handful of pushes and destruction, as in a per-message handler list
+    bench::run(push, rounds, [&] {
+        for (size_t r = 0; r < rounds; ++r) {
+            V v;
+            for (size_t h = 0; h < handlers; ++h) v.push(&on_message);
+            bench::do_not_optimize(v.len());
+        }
+    });
+
+    // Destruction of already populated lists
+    alignas(V) static unsigned char storage[sizeof(V) * 1024];
+    auto* lists = reinterpret_cast<V*>(storage);
+    double total = 0.0;
+    for (size_t batch = 0; batch < rounds / 1024; ++batch) {
+        for (size_t i = 0; i < 1024; ++i) {
+            std::construct_at(lists + i);
+            for (size_t h = 0; h < handlers; ++h) lists[i].push(&on_message);
+        }
+        total += bench::elapsed_ns([&] { std::destroy(lists, lists + 1024); });
+    }
+    bench::report(destroy, total / static_cast<double>(rounds));
+}
+
+int main() {
+    measure<oxide::Vec<Handler>>("Vec<Handler> construct", "Vec<Handler> construct+push x6", "Vec<Handler> destroy");
+    measure<oxide::SmallVec<Handler, 8>>("SmallVec<Handler, 8> construct", "SmallVec<Handler, 8> construct+push x6", "SmallVec<Handler, 8> destroy");
+    return 0;
+}
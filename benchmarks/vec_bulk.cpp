@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+struct Record64 {
+    std::uint64_t fields[8];
+};
+static_assert(sizeof(Record64) == 64 && std::is_trivially_copyable_v<Record64>);
+
+// Bulk operations on trivially copyable element types, Vec against raw std::vector
+template <typename T>
+static void measure(const std::string& label) {
+    using namespace oxide;
+    constexpr size_t count = 1 << 14;
+    constexpr size_t edits = 256;
+
+    std::vector<T> source(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::memset(static_cast<void*>(&source[i]), static_cast<int>(i & 0x7f), sizeof(T));
+    }
+    const Vec<T> seed(source.begin(), source.end());
+
+    const auto name = [&](const char* op) { return label + " " + op; };
+
+    bench::run(name("std::vector insert(middle)").c_str(), edits, [&] {
+        std::vector<T> v(source);
+        for (size_t i = 0; i < edits; ++i) v.insert(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2), source[i]);
+        bench::do_not_optimize(v.data());
+    });
+    bench::run(name("Vec insert(middle)").c_str(), edits, [&] {
+        Vec<T> v(seed);
+        for (size_t i = 0; i < edits; ++i) v.insert(v.len() / 2, source[i]);
+        bench::do_not_optimize(v.as_ptr());
+    });
+
+    bench::run(name("std::vector erase(middle)").c_str(), edits, [&] {
+        std::vector<T> v(source);
+        for (size_t i = 0; i < edits; ++i) {
+            T value = v[v.size() / 2];
+            v.erase(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2));
+            bench::do_not_optimize(value);
+        }
+    });
+    bench::run(name("Vec remove(middle)").c_str(), edits, [&] {
+        Vec<T> v(seed);
+        for (size_t i = 0; i < edits; ++i) bench::do_not_optimize(v.remove(v.len() / 2));
+    });
+
+    bench::run(name("std::vector insert(end, range)").c_str(), count, [&] {
+        std::vector<T> v;
+        v.insert(v.end(), source.begin(), source.end());
+        bench::do_not_optimize(v.data());
+    });
+    bench::run(name("Vec extend_from_slice").c_str(), count, [&] {
+        Vec<T> v;
+        v.extend_from_slice(source);
+        bench::do_not_optimize(v.as_ptr());
+    });
+
+    bench::run(name("Vec copy construct").c_str(), count, [&] {
+        Vec<T> v(seed);
+        bench::do_not_optimize(v.as_ptr());
+    });
+
+    bench::run(name("Vec truncate + clear").c_str(), count, [&] {
+        Vec<T> v(seed);
+        v.truncate(count / 2);
+        v.clear();
+        bench::do_not_optimize(v.len());
+    });
+}
+
+int main() {
+    measure<int>("Vec<int>");
+    measure<double>("Vec<double>");
+    measure<Record64>("Vec<Record64>");
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <cstdio>
+
+#include "bench.hpp"
+
+// Bounds-checked operations, built twice: once as usual and once with -fno-exceptions and
+// OXIDE_NO_EXCEPTIONS (oxide_vec_checked_noexcept_bench). Compare the throughput printed by both
+// and their code size, e.g. `size oxide_vec_checked_bench oxide_vec_checked_noexcept_bench`.
+int main() {
+    using namespace oxide;
+    constexpr size_t count = 1 << 16;
+    constexpr size_t passes = 64;
+
+#if defined(OXIDE_NO_EXCEPTIONS)
+    std::puts("mode: OXIDE_NO_EXCEPTIONS (checks panic)");
+#else
+    std::puts("mode: exceptions (checks throw std::out_of_range)");
+#endif
+
+    Vec<int> vec;
+    for (size_t i = 0; i < count; ++i) vec.push(static_cast<int>(i));
+
+    bench::run("Vec operator[] (checked)", count * passes, [&] {
+        long long sum = 0;
+        for (size_t p = 0; p < passes; ++p) {
+            for (size_t i = 0; i < vec.len(); ++i) sum += vec[i];
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("Vec insert + remove near the end", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            const size_t at = vec.len() - (i & 7);
+            vec.insert(at, static_cast<int>(i));
+            bench::do_not_optimize(vec.remove(at));
+        }
+    });
+
+    bench::run("Vec swap_remove + push", count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            const int value = vec.swap_remove(i);
+            vec.push(value);
+        }
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    bench::run("Vec drain(iota) of last 8 + extend_from_slice", count / 8, [&] {
+        int buffer[8];
+        for (size_t i = 0; i < count / 8; ++i) {
+            size_t n = 0;
+            for (const int value : vec.drain(std::views::iota(vec.len() - 8, vec.len()))) buffer[n++] = value;
+            vec.extend_from_slice(std::span<const int>(buffer, n));
+        }
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    return 0;
+}
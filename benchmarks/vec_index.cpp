@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+
+// Indexing parity benchmark: Vec::operator[] / get() / get_unchecked() against raw std::vector
+int main() {
+    using namespace oxide;
+    using Record = std::pair<std::string, int>;
+
+    constexpr size_t count = 1 << 16;
+    constexpr size_t passes = 64;
+
+    std::vector<Record> raw;
+    Vec<Record> vec;
+    for (size_t i = 0; i < count; ++i) {
+        raw.emplace_back("user" + std::to_string(i), static_cast<int>(i));
+        vec.push({"user" + std::to_string(i), static_cast<int>(i)});
+    }
+
+    bench::run("std::vector operator[]", count * passes, [&] {
+        long long sum = 0;
+        for (size_t p = 0; p < passes; ++p) {
+            for (size_t i = 0; i < raw.size(); ++i) sum += raw[i].second;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("Vec operator[] (checked)", count * passes, [&] {
+        long long sum = 0;
+        for (size_t p = 0; p < passes; ++p) {
+            for (size_t i = 0; i < vec.len(); ++i) sum += vec[i].second;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("Vec get() (Option<T&>)", count * passes, [&] {
+        long long sum = 0;
+        for (size_t p = 0; p < passes; ++p) {
+            for (size_t i = 0; i < vec.len(); ++i) {
+                if (const auto rec = vec.get(i)) sum += rec->second;
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("Vec get_unchecked()", count * passes, [&] {
+        long long sum = 0;
+        for (size_t p = 0; p < passes; ++p) {
+            for (size_t i = 0; i < vec.len(); ++i) sum += vec.get_unchecked(i).second;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    static_assert(sizeof(Option<Record&>) == sizeof(Record*), "Option<T&> must stay pointer-sized");
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include "bench.hpp"
+
+// Sequential vs parallel scans over a keyed table, with uneven per-element work; pass a record count
+// to override the default and set OXIDE_NUM_THREADS to pin the pool size
+int main(const int argc, char** argv) {
+    using namespace oxide;
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+
+    Vec<std::pair<std::string, int>> table;
+    table.reserve(count);
+    for (size_t i = 0; i < count; ++i) table.push({"user" + std::to_string(i), static_cast<int>(i)});
+    const std::string key = "user" + std::to_string(count - 1);  // Worst case for a linear scan
+
+    // Cost grows with the value, so equal-sized pieces would finish at very different times
+    const auto uneven = [](const std::pair<std::string, int>& rec) {
+        unsigned h = static_cast<unsigned>(rec.second);
+        for (int i = 0; i < (rec.second & 63); ++i) h = h * 2654435761u + 1;
+        return h;
+    };
+
+    std::printf("pool threads: %zu\n", ThreadPool::global().num_threads());
+    bench::run("iter() find", count, [&] {
+        const auto it = std::ranges::find_if(table.iter(), [&](const auto& rec) { return rec.first == key; });
+        bench::do_not_optimize(it);
+    });
+    bench::run("par_iter().find_any", count, [&] {
+        const auto found = table.par_iter().find_any([&](const auto& rec) { return rec.first == key; });
+        bench::do_not_optimize(found);
+    });
+    bench::run("iter() uneven map + sum", count, [&] {
+        unsigned sum = 0;
+        for (const auto& rec : table.iter()) sum += uneven(rec);
+        bench::do_not_optimize(sum);
+    });
+    bench::run("par_iter().map(uneven).reduce", count, [&] {
+        const unsigned sum = table.par_iter().map(uneven).reduce(0u, std::plus<>{});
+        bench::do_not_optimize(sum);
+    });
+
+    return 0;
+}
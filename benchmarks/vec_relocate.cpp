@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <oxide.hpp>
+
+#include <cstdio>
+#include <memory>
+
+#include "bench.hpp"
+
+// Same layout as std::unique_ptr<int>, but not marked trivially relocatable
+struct Boxed {
+    std::unique_ptr<int> ptr;
+};
+
+template <typename T, typename Make>
+void run_pair(const char* insert_name, const char* drain_name, const char* append_name, const char* grow_name, Make make) {
+    using namespace oxide;
+    constexpr size_t count = 1 << 14;
+
+    bench::run(insert_name, 1024, [&] {
+        Vec<T> vec;
+        for (size_t i = 0; i < count; ++i) vec.push(make(i));
+        for (size_t i = 0; i < 512; ++i) {
+            vec.insert(i, make(i));
+            bench::do_not_optimize(vec.remove(i * 2));
+        }
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    bench::run(drain_name, 256, [&] {
+        Vec<T> vec;
+        for (size_t i = 0; i < count; ++i) vec.push(make(i));
+        for (size_t i = 0; i < 256; ++i) {
+            auto drained = vec.drain(std::views::iota(i, i + 4));
+        }
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    {
+        // The elements bounce between two vectors; the emptied one gets one element back, so
+        // append() can never just steal the buffer
+        Vec<T> left;
+        Vec<T> right;
+        for (size_t i = 0; i < count; ++i) left.push(make(i));
+        right.push(make(0));
+        bench::run(append_name, 2 * count, [&] {
+            right.append(left);
+            left.push(make(0));
+            left.append(right);
+            right.push(make(0));
+            bench::do_not_optimize(left.as_ptr());
+        });
+    }
+
+    bench::run(grow_name, count, [&] {
+        SmallVec<T, 8> vec;
+        for (size_t i = 0; i < count; ++i) vec.push(make(i));
+        bench::do_not_optimize(vec.len());
+    });
+}
+
+int main() {
+    run_pair<std::unique_ptr<int>>("Vec<unique_ptr> insert+remove (relocate)",
+                                   "Vec<unique_ptr> drain 4 (relocate)",
+                                   "Vec<unique_ptr> append (relocate)",
+                                   "SmallVec<unique_ptr> push/grow (relocate)",
+                                   [](size_t i) { return std::make_unique<int>(static_cast<int>(i)); });
+    run_pair<Boxed>("Vec<Boxed> insert+remove (move)",
+                    "Vec<Boxed> drain 4 (move)",
+                    "Vec<Boxed> append (move)",
+                    "SmallVec<Boxed> push/grow (move)",
+                    [](size_t i) { return Boxed{std::make_unique<int>(static_cast<int>(i))}; });
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+
+// Point lookups on a sorted table larger than L2; pass an element count to override the default
+int main(const int argc, char** argv) {
+    using namespace oxide;
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+    constexpr size_t queries = 1 << 20;
+
+    std::mt19937_64 rng(7);
+    Vec<std::uint32_t> table;
+    table.reserve(count);
+    for (size_t i = 0; i < count; ++i) table.push(static_cast<std::uint32_t>(rng()));
+    table.sort_unstable();
+    const EytzingerIndex<std::uint32_t> index(table.as_slice());
+
+    std::vector<std::uint32_t> probes(queries);
+    for (auto& p : probes) p = static_cast<std::uint32_t>(rng());
+
+    bench::run("std::lower_bound", queries, [&] {
+        size_t hits = 0;
+        const auto slice = table.as_slice();
+        for (const auto p : probes) {
+            const auto it = std::lower_bound(slice.begin(), slice.end(), p);
+            hits += it != slice.end() && *it == p;
+        }
+        bench::do_not_optimize(hits);
+    });
+    bench::run("Vec::binary_search", queries, [&] {
+        size_t hits = 0;
+        for (const auto p : probes) hits += table.binary_search(p).has_value();
+        bench::do_not_optimize(hits);
+    });
+    bench::run("EytzingerIndex::search", queries, [&] {
+        size_t hits = 0;
+        for (const auto p : probes) hits += index.search(p).has_value();
+        bench::do_not_optimize(hits);
+    });
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+
+#include "bench.hpp"
+
+// Membership scans over an ID vector, one line per instruction set; pass an element count to override
+// the default. The needle is absent, so every scan reads the whole vector.
+int main(const int argc, char** argv) {
+    using namespace oxide;
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    std::mt19937 rng(42);
+    Vec<std::uint32_t> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i) ids.push(rng() | 1u);
+    constexpr std::uint32_t missing = 2;  // Even, never generated
+
+    bench::run("std::ranges::find", count, [&] {
+        bench::do_not_optimize(std::ranges::find(ids.as_slice(), missing));
+    });
+    bench::run("oxide::find (predicate)", count, [&] {
+        bench::do_not_optimize(find(ids.iter(), [](const std::uint32_t id) { return id == missing; }));
+    });
+
+    constexpr std::pair<simd::Isa, const char*> isas[] = {
+        {simd::Isa::Scalar, "scalar"}, {simd::Isa::SSE2, "sse2"}, {simd::Isa::AVX2, "avx2"}, {simd::Isa::AVX512, "avx512"}};
+    char name[64];
+    for (const auto& [isa, label] : isas) {
+        if (isa > simd::detected_isa()) break;
+        std::snprintf(name, sizeof(name), "simd::position [%s]", label);
+        bench::run(name, count, [&] { bench::do_not_optimize(simd::position(ids.as_slice(), missing, isa)); });
+        std::snprintf(name, sizeof(name), "simd::count [%s]", label);
+        bench::run(name, count, [&] { bench::do_not_optimize(simd::count(ids.as_slice(), missing, isa)); });
+        std::snprintf(name, sizeof(name), "simd::extremum<max> [%s]", label);
+        bench::run(name, count, [&] { bench::do_not_optimize(simd::extremum<true>(ids.as_slice(), isa)); });
+        std::snprintf(name, sizeof(name), "simd::sum [%s]", label);
+        bench::run(name, count, [&] { bench::do_not_optimize(simd::sum(ids.as_slice(), isa)); });
+    }
+    bench::run("Vec::contains (dispatched)", count, [&] { bench::do_not_optimize(ids.contains(missing)); });
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+#include <oxide.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+
+// Vec sorting against std::sort / std::stable_sort; pass an element count to override the default
+int main(const int argc, char** argv) {
+    using namespace oxide;
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+    std::mt19937_64 rng(42);
+    std::vector<std::uint64_t> numbers(count);
+    for (auto& n : numbers) n = rng();
+
+    const auto once = [](const char* name, const size_t ops, auto&& body) { bench::run(name, ops, body, 1); };
+
+    once("std::sort Vec<uint64_t>", count, [&] {
+        auto v = numbers;
+        std::sort(v.begin(), v.end());
+        bench::do_not_optimize(v.data());
+    });
+    once("std::stable_sort Vec<uint64_t>", count, [&] {
+        auto v = numbers;
+        std::stable_sort(v.begin(), v.end());
+        bench::do_not_optimize(v.data());
+    });
+    once("Vec::sort_unstable (radix) Vec<uint64_t>", count, [&] {
+        Vec<std::uint64_t> v{std::vector(numbers)};
+        v.sort_unstable();
+        bench::do_not_optimize(v.as_ptr());
+    });
+    once("Vec::par_sort Vec<uint64_t>", count, [&] {
+        Vec<std::uint64_t> v{std::vector(numbers)};
+        v.par_sort();
+        bench::do_not_optimize(v.as_ptr());
+    });
+
+    using Record = std::pair<std::string, int>;
+    const size_t records = count / 5;
+    std::vector<Record> table;
+    table.reserve(records);
+    for (size_t i = 0; i < records; ++i) {
+        table.emplace_back("user" + std::to_string(i), static_cast<int>(rng() % 1'000'000));
+    }
+    const auto by_value = [](const Record& a, const Record& b) { return a.second < b.second; };
+    const auto value_of = [](const Record& r) { return r.second; };
+
+    once("std::sort pair<string,int> by .second", records, [&] {
+        auto v = table;
+        std::sort(v.begin(), v.end(), by_value);
+        bench::do_not_optimize(v.data());
+    });
+    once("std::stable_sort pair<string,int> by .second", records, [&] {
+        auto v = table;
+        std::stable_sort(v.begin(), v.end(), by_value);
+        bench::do_not_optimize(v.data());
+    });
+    once("Vec::sort_unstable_by_key (radix) by .second", records, [&] {
+        Vec<Record> v{std::vector(table)};
+        v.sort_unstable_by_key(value_of);
+        bench::do_not_optimize(v.as_ptr());
+    });
+    once("Vec::sort_by_cached_key by .second", records, [&] {
+        Vec<Record> v{std::vector(table)};
+        v.sort_by_cached_key(value_of);
+        bench::do_not_optimize(v.as_ptr());
+    });
+    once("Vec::par_sort_by by .second", records, [&] {
+        Vec<Record> v{std::vector(table)};
+        v.par_sort_by(by_value);
+        bench::do_not_optimize(v.as_ptr());
+    });
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <oxide.hpp>
+
+#include <cstdint>
+#include <cstdio>
+
+#include "bench.hpp"
+
+// Merging a batch of records into the middle of a large Vec: per-element insert shifts the
+// tail once per record, insert_many and splice shift it once per batch
+int main() {
+    using namespace oxide;
+    constexpr size_t count = 1 << 18;
+    constexpr size_t batch = 1024;
+
+    Vec<std::uint64_t> base;
+    base.extend(std::views::iota(std::uint64_t{0}, std::uint64_t{count}));
+    Vec<std::uint64_t> records;
+    records.extend(std::views::iota(std::uint64_t{0}, std::uint64_t{batch}));
+
+    bench::run("Vec::insert x1024 at len/2", batch, [&] {
+        Vec<std::uint64_t> vec = base;
+        for (size_t i = 0; i < batch; ++i) vec.insert(count / 2 + i, records[i]);
+        bench::do_not_optimize(vec.as_ptr());
+    }, 3);
+
+    bench::run("Vec::insert_many(1024) at len/2", batch, [&] {
+        Vec<std::uint64_t> vec = base;
+        vec.insert_many(count / 2, records.as_slice());
+        bench::do_not_optimize(vec.as_ptr());
+    }, 3);
+
+    bench::run("Vec::splice(16 -> 1024) at len/2", batch, [&] {
+        Vec<std::uint64_t> vec = base;
+        auto removed = vec.splice(std::views::iota(count / 2, count / 2 + 16), records.as_slice());
+        bench::do_not_optimize(removed.as_ptr());
+        bench::do_not_optimize(vec.as_ptr());
+    }, 3);
+
+    bench::run("Vec::extend(iota) sized", count, [&] {
+        Vec<std::uint64_t> vec;
+        vec.extend(std::views::iota(std::uint64_t{0}, std::uint64_t{count}));
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    bench::run("Vec::push loop", count, [&] {
+        Vec<std::uint64_t> vec;
+        for (std::uint64_t i = 0; i < count; ++i) vec.push(i);
+        bench::do_not_optimize(vec.as_ptr());
+    });
+
+    return 0;
+}
@@ -50,8 +50,8 @@ int main() {
 
     // Demonstrate get() and mutable access
     if (const auto record = db.get(0)) {
-        std::cout << "First record: " << record->get().first << " -> " << record->get().second << "\n";
-        record->get().second = 999;  // Modify
+        std::cout << "First record: " << record->first << " -> " << record->second << "\n";
+        record->second = 999;  // Modify
     }
 
     // Demonstrate iter() const
@@ -89,22 +89,19 @@ int main() {
                 std::cout << "Inserted: " << ins.key << " -> " << ins.value << "\n";
             },
             [&](const Update& upd) {
-                bool found = false;
-                for (auto& [key, val] : db.iter_mut()) {
-                    if (key == upd.key) {
-                        val = upd.new_value;
-                        std::cout << "Updated: " << upd.key << "=" << upd.new_value << "\n";
-                        found = true;
-                        break;
-                    }
+                // Keys are unique, so any match will do: the scan is split across all cores
+                if (const auto record = db.par_iter_mut().find_any([&](const auto& rec) { return rec.first == upd.key; })) {
+                    record->second = upd.new_value;
+                    std::cout << "Updated: " << upd.key << "=" << upd.new_value << "\n";
+                } else {
+                    std::cout << "Update failed: key not found\n";
                 }
-                if (!found) std::cout << "Update failed: key not found\n";
             },
             [&](const Delete& del) {
                 bool found = false;
                 for (size_t i = 0; i < db.len(); ++i) {
-                    if (const auto rec = db.get(i); rec && rec->get().first == del.key) {
-                        auto [key, val] = db.remove(i);
+                    if (const auto rec = db.get(i); rec && rec->first == del.key) {
+                        auto [key, val] = db.swap_remove(i);  // Order does not matter, O(1)
                         std::cout << "Deleted: " << key << "=" << val << "\n";
                         found = true;
                         break;
@@ -113,15 +110,11 @@ int main() {
                 if (!found) std::cout << "Delete failed: key not found\n";
             },
             [&](const Select& sel) {
-                bool found = false;
-                for (const auto& [key, val] : db.iter()) {
-                    if (key == sel.key) {
-                        sel.callback(val);
-                        found = true;
-                        break;
-                    }
+                if (const auto record = db.par_iter().find_any([&](const auto& rec) { return rec.first == sel.key; })) {
+                    sel.callback(record->second);
+                } else {
+                    std::cout << "Select failed: key not found\n";
                 }
-                if (!found) std::cout << "Select failed: key not found\n";
             },
             [&](const Noop&) {
                 std::cout << "No operation performed\n";
@@ -136,6 +129,22 @@ int main() {
     db_handler(op4);
     db_handler(op5);
 
+    // Bulk purge: drop every record below a threshold in a single compaction pass
+    db.retain([](const std::pair<std::string, int>& rec) { return rec.second >= 100; });
+    std::cout << "After retain(value >= 100): " << db.len() << " records\n";
+
+    // Lazily extract matching records, e.g. to archive them elsewhere
+    size_t archived = 0;
+    for (auto&& [key, val] : db.extract_if([](std::pair<std::string, int>& rec) { return rec.second >= 900; })) {
+        std::cout << "Archived: " << key << "=" << val << "\n";
+        ++archived;
+    }
+    std::cout << "Archived " << archived << " records, " << db.len() << " remain\n";
+
+    // Parallel aggregate over every record
+    const int total = db.par_iter().map([](const auto& rec) { return rec.second; }).reduce(0, std::plus<>{});
+    std::cout << "Sum of values: " << total << "\n";
+
     // Final state
     std::cout << "Final database size: " << db.len() << "\n";
     std::cout << "Is empty: " << (db.is_empty() ? "true" : "false") << "\n";
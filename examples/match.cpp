@@ -66,7 +66,7 @@ int main() {
     Option<std::string> user_name = Some(std::string("Player1"));
     Option<int> max_moves = None<int>();  // Not configured
 
-    std::cout << "User: " << user_name.unwrap_or("Anonymous") << "\n";
+    std::cout << "User: " << user_name.unwrap_or_else([] { return std::string("Anonymous"); }) << "\n";
     std::cout << "Max moves: " << max_moves.unwrap_or(100) << "\n";
 
     // Alternative way to define messages (type is implicit)
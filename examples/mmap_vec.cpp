@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+#include <oxide.hpp>
+#include <oxide/mmap_vec.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+// Persistent vector example: reopening a file and the errors open() reports
+namespace {
+    struct Trade {
+        std::uint64_t id;
+        double price;
+    };
+
+    struct Tick {
+        std::uint32_t id;
+    };
+
+    int failures = 0;
+
+    void check(const bool ok, const char* what) {
+        std::cout << (ok ? "ok:   " : "FAIL: ") << what << "\n";
+        failures += ok ? 0 : 1;
+    }
+
+    template <typename T>
+    bool fails_with(const oxide::Result<oxide::MmapVec<T>, oxide::MmapError>& opened, const oxide::MmapError::Kind kind) {
+        return !opened && opened.error().kind == kind;
+    }
+}
+
+int main() {
+    using namespace oxide;
+    namespace fs = std::filesystem;
+
+    const fs::path path = fs::temp_directory_path() / "oxide_mmap_vec_example.bin";
+    fs::remove(path);
+
+    {
+        auto opened = MmapVec<Trade>::open(path, 1);
+        check(opened.has_value(), "create a new file");
+        MmapVec<Trade>& trades = *opened;
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            trades.push(Trade{i, 100.0 + static_cast<double>(i)});
+        }
+
+        // Appending the vector to itself, at full capacity, forces the mapping to move
+        while (trades.len() < trades.capacity()) {
+            trades.push(trades[0]);
+        }
+        const size_t before = trades.len();
+        trades.extend_from_slice(trades.as_slice());
+        check(trades.len() == 2 * before && trades[before].id == 0 && trades[before + 999].id == 999,
+              "extend_from_slice with a view of itself");
+        while (trades.len() < trades.capacity()) {
+            trades.push(trades[1]);
+        }
+        trades.push(trades[2]);
+        check(trades[trades.len() - 1].id == 2, "push of one of its own elements");
+
+        trades.truncate(1000);
+        check(fails_with(MmapVec<Trade>::open(path, 1), MmapError::Kind::Locked), "second open is refused");
+        check(trades.flush().has_value(), "flush");
+    }
+
+    {
+        auto reopened = MmapVec<Trade>::open(path, 1);
+        check(reopened && reopened->len() == 1000 && (*reopened)[999].price == 1099.0, "reopen keeps the data");
+    }
+
+    check(fails_with(MmapVec<Trade>::open(path, 2), MmapError::Kind::VersionMismatch), "other schema version");
+    check(fails_with(MmapVec<Tick>::open(path, 1), MmapError::Kind::LayoutMismatch), "other element type");
+
+    const fs::path text = fs::temp_directory_path() / "oxide_mmap_vec_example.txt";
+    std::ofstream(text) << "this is not an mmap vec, but it is longer than the 64-byte header it would need\n";
+    check(fails_with(MmapVec<Trade>::open(text), MmapError::Kind::NotAnMmapVec), "foreign file");
+
+    fs::remove(path);
+    fs::remove(text);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+#include <oxide.hpp>
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace oxide;
+
+// Compile-time checks of Option's layout and special members. They live here rather than in
+// option.hpp so that consumers of the header do not pay for them.
+static_assert(sizeof(Option<int>) == 2 * sizeof(int) && sizeof(Option<char>) == 2);
+static_assert(std::is_trivially_copyable_v<Option<int>>);
+// std::pair assigns member-wise, but trivial copies and destruction suffice for register passing
+static_assert(std::is_trivially_copy_constructible_v<Option<std::pair<int, int>>> &&
+              std::is_trivially_move_constructible_v<Option<std::pair<int, int>>> &&
+              std::is_trivially_destructible_v<Option<std::pair<int, int>>>);
+// The flag fills T's tail padding or takes one alignment unit, never more
+static_assert(sizeof(Option<std::pair<int, int>>) == 12 && alignof(Option<std::pair<int, int>>) == alignof(int));
+static_assert(std::is_trivially_destructible_v<Option<double>>);
+static_assert(std::is_trivially_copyable_v<Option<int*>>);
+static_assert(!std::is_trivially_copyable_v<Option<std::unique_ptr<int>>>);
+static_assert(!std::is_trivially_destructible_v<Option<std::unique_ptr<int>>>);
+
+namespace {
+    // A payload with user-provided copies and destructor, to exercise the non-trivial paths
+    struct ConstexprProbe {
+        int value;
+        constexpr explicit ConstexprProbe(const int v) noexcept : value(v) {}
+        constexpr ConstexprProbe(const ConstexprProbe& other) noexcept : value(other.value) {}
+        constexpr ~ConstexprProbe() {}
+    };
+
+    consteval bool option_is_constexpr() {
+        Option<ConstexprProbe> a(ConstexprProbe(1));
+        Option<ConstexprProbe> b = a;
+        b.reset();
+        b = a;
+        const Option<int> c = Option<int>(2).and_then([](int x) { return Option<int>(x + 1); });
+        return a.value().value == 1 && b.has_value() && c.unwrap_or(0) == 3 && Option<int>().unwrap_or(4) == 4;
+    }
+    static_assert(option_is_constexpr());
+
+    // A compile-time table, None entries included
+    struct Config {
+        int port;
+        bool tls;
+    };
+    constexpr std::array<Option<Config>, 3> configs{Some(Config{80, false}), Option<Config>(), Some(Config{443, true})};
+    static_assert(configs[0]->port == 80 && !configs[1].has_value() && configs[2]->tls);
+
+    constexpr Option<int> no_int;
+    static_assert(!no_int.has_value() && no_int.unwrap_or(7) == 7);
+
+    // Transient allocations: an Option<std::string> is built, copied and dropped during constant evaluation
+    consteval bool option_string_is_constexpr() {
+        Option<std::string> greeting;
+        greeting = std::string("hello");
+        const Option<std::string> copy = greeting;
+        greeting.reset();
+        return !greeting.has_value() && copy->size() == 5;
+    }
+    static_assert(option_string_is_constexpr());
+
+    // As with std::optional, a move leaves the source engaged for every T; only take() empties it
+    consteval bool moved_from_stays_engaged() {
+        Option<int> number = Some(1);
+        const Option<int> number_moved = std::move(number);
+        Option<std::string> text = Some(std::string("payload"));
+        const Option<std::string> text_moved = std::move(text);
+        Option<std::string> source = Some(std::string("assigned"));
+        Option<std::string> target;
+        target = std::move(source);
+        const bool engaged = number.has_value() && text.has_value() && source.has_value();
+        const Option<std::string> taken = target.take();
+        return engaged && *number_moved == 1 && *text_moved == "payload" && !target.has_value() && *taken == "assigned";
+    }
+    static_assert(moved_from_stays_engaged());
+}
+
+// Option usage example
+int main() {
+    Option<std::string> name = Some(std::string("Ferris"));
+    Option<std::string> nickname;
+
+    // map / filter / unwrap_or_else
+    const auto length = name.map([](const std::string& s) { return s.size(); });
+    std::cout << "Name length: " << length.unwrap_or(0) << "\n";
+    std::cout << "Nickname: " << nickname.unwrap_or_else([] { return std::string("(none)"); }) << "\n";
+    const auto long_name = name.filter([](const std::string& s) { return s.size() > 10; });
+    std::cout << "Long name: " << (long_name ? "yes" : "no") << "\n";
+
+    // take / replace / get_or_insert_with
+    const Option<std::string> previous = name.replace("Corro");
+    std::cout << "Replaced " << *previous << " with " << *name << "\n";
+    nickname.get_or_insert_with([] { return std::string("crab"); }).append("!");
+    std::cout << "Nickname now: " << *nickname << "\n";
+    const Option<std::string> taken = nickname.take();
+    std::cout << "Taken: " << *taken << ", left behind: " << (nickname ? "Some" : "None") << "\n";
+
+    // ok_or converts to Result
+    const Result<std::string, std::string> lookup = nickname.ok_or(std::string("no nickname"));
+    std::cout << "Lookup: " << (lookup ? *lookup : lookup.error()) << "\n";
+
+    // In-place construction, no temporary string
+    Option<std::string> stars(std::in_place, 5, '*');
+    stars.emplace(3, '+');
+    std::cout << "Stars: " << *stars << "\n";
+
+    // Niches: no flag needed for pointers
+    std::cout << "sizeof(Option<int*>) = " << sizeof(Option<int*>) << ", sizeof(int*) = " << sizeof(int*) << "\n";
+    return 0;
+}
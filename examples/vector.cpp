@@ -21,8 +21,11 @@
  */
 #include <oxide.hpp>
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <memory_resource>
 
 // Vector usage example
 int main() {
@@ -50,8 +53,8 @@ int main() {
     v = {10, 20};
 
     if (const auto val = v.get(0)) {
-        std::cout << "Get[0]: " << val->get() << "\n";  // Outputs: Get[0]: 10 (val is Option<ref<int>>)
-        val->get() = 100;  // Mutable access (modifies v[0])
+        std::cout << "Get[0]: " << *val << "\n";  // Outputs: Get[0]: 10 (val is Option<int&>)
+        *val = 100;  // Mutable access (modifies v[0])
     }
 
     if (v.get(99)) {
@@ -60,10 +63,93 @@ int main() {
         std::cout << "Get[99]: None\n";
     }
 
+    // operator[] (bounds checked) and get_unchecked() (caller proves bounds)
+    int sum = 0;
+    for (size_t i = 0; i < v.len(); ++i) {
+        sum += v.get_unchecked(i);
+    }
+    std::cout << "Sum: " << sum << ", v[1]: " << v[1] << "\n";
+
     // Get contact reference
     const Vec<int> cv{100, 200};
     if (const auto val = cv.get(0)) {
-        std::cout << "Const get[0]: " << val->get() << "\n";
+        std::cout << "Const get[0]: " << *val << "\n";
+    }
+
+    // Allocator-aware Vec: request-scoped storage on a monotonic arena
+    std::array<std::byte, 1024> arena_buffer{};
+    std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size());
+    {
+        pmr::Vec<int> scratch(&arena);
+        scratch.reserve(16);
+        for (int i = 0; i < 16; ++i) {
+            scratch.push(i * i);
+        }
+        std::cout << "Arena Vec length: " << scratch.len() << ", last: " << scratch[15] << "\n";
+    }
+    arena.release();  // Frees everything allocated for the request at once
+
+    // Growth policies: 1.5x instead of the standard library's factor, or fixed steps
+    Vec<int, std::allocator<int>, growth::Factor1_5> gentle;
+    Vec<int, std::allocator<int>, growth::Fixed<64>> stepped;
+    for (int i = 0; i < 100; ++i) {
+        gentle.push(i);
+        stepped.push(i);
+    }
+    std::cout << "1.5x capacity: " << gentle.capacity() << ", fixed(64) capacity: " << stepped.capacity() << "\n";
+
+    // Uninitialized append: a producer writes straight into spare capacity, no zero-fill pass
+    Vec<unsigned char, DefaultInitAllocator<unsigned char>> ingest;
+    ingest.reserve(64);
+    const auto spare = ingest.spare_capacity_mut();
+    const size_t produced = 32;  // e.g. the return value of read(fd, spare.data(), spare.size())
+    for (size_t i = 0; i < produced; ++i) {
+        spare[i] = static_cast<unsigned char>('a' + i % 26);
+    }
+    ingest.set_len(produced);
+    std::cout << "Ingested " << ingest.len() << " bytes, first: " << ingest[0] << "\n";
+
+    // SmallVec keeps up to N elements inline and only allocates once it outgrows them
+    SmallVec<int, 4> small{1, 2, 3};
+    std::cout << "SmallVec spilled: " << (small.spilled() ? "true" : "false") << "\n";
+    small.push(4);
+    small.push(5);
+    std::cout << "SmallVec spilled after 5 pushes: " << (small.spilled() ? "true" : "false") << "\n";
+    for (const int drained : small.drain(std::views::iota(0, 2))) {
+        std::cout << "Drained: " << drained << "\n";
+    }
+    std::cout << "SmallVec length: " << small.len() << "\n";
+
+    // Batched processing: fixed-size chunks with the tail handled separately, no hand slicing
+    Vec<float> samples;
+    for (int i = 0; i < 10; ++i) {
+        samples.push(static_cast<float>(i));
+    }
+    const auto batches = samples.as_chunks<4>();
+    for (const std::span<const float, 4> batch : batches) {
+        float sum = 0.0f;
+        for (const float x : batch) {  // Fixed extent: the compiler can unroll this loop
+            sum += x;
+        }
+        std::cout << "Batch sum: " << sum << "\n";
+    }
+    std::cout << "Leftover samples: " << batches.remainder().size() << "\n";
+    for (const auto window : samples.windows(3) | std::views::take(2)) {
+        std::cout << "Window starts at: " << window.front() << "\n";
+    }
+
+    // Vectorized scans for arithmetic elements (AVX-512/AVX2/SSE2 picked at runtime)
+    std::cout << "Contains 7: " << (samples.contains(7.0f) ? "true" : "false")
+              << ", position of 3: " << samples.position(3.0f).unwrap_or(samples.len())
+              << ", max: " << samples.max().unwrap_or(0.0f) << ", sum: " << samples.sum() << "\n";
+
+    // Fallible growth: shed the work instead of unwinding when memory is capped
+    Vec<std::uint64_t> budgeted;
+    if (const auto reserved = budgeted.try_reserve(std::size_t{1} << 62); !reserved) {
+        std::cout << "try_reserve failed: " << reserved.error().what() << "\n";
+    }
+    if (budgeted.try_push(42)) {
+        std::cout << "try_push succeeded, length: " << budgeted.len() << "\n";
     }
 
     return 0;
@@ -33,14 +33,143 @@
 #include <stdexcept>
 #include <span>
 #include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <compare>
+#include <bit>
+#include <memory>
+#include <memory_resource>
+#include <list>
+#include <atomic>
+#include <numeric>
 
 #define OXIDE_VERSION_MAJOR 1
 #define OXIDE_VERSION_MINOR 1
 #define OXIDE_VERSION_PATCH 2
 
+#include "oxide/config.hpp"
 #include "oxide/option.hpp"
+#include "oxide/alloc.hpp"
+#include "oxide/relocate.hpp"
+#include "oxide/sort.hpp"
+#include "oxide/slice.hpp"
+#include "oxide/thread_pool.hpp"
+#include "oxide/simd.hpp"
+
+#if defined(_MSC_VER)
+#define OXIDE_NOINLINE __declspec(noinline)
+#define OXIDE_COLD
+#if defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#define OXIDE_PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define OXIDE_PREFETCH(addr) ((void)(addr))
+#endif
+#else
+#define OXIDE_NOINLINE __attribute__((noinline))
+#define OXIDE_COLD __attribute__((cold))
+#define OXIDE_PREFETCH(addr) __builtin_prefetch(addr)
+#endif
 
 namespace oxide {
+    namespace detail {
+        // Three-way comparison built from operator<, for types without operator<=>
+        template <typename A, typename B>
+        constexpr auto weak_compare(const A& a, const B& b) -> std::weak_ordering {
+            if (a < b) return std::weak_ordering::less;
+            if (b < a) return std::weak_ordering::greater;
+            return std::weak_ordering::equivalent;
+        }
+
+        // Element types whose bulk moves can be done with memmove/memcpy
+        template <typename T>
+        inline constexpr bool bitwise_copyable = std::is_trivially_copyable_v<T>;
+
+        // Element types that may be shifted with memmove, see oxide::is_trivially_relocatable
+        template <typename T>
+        inline constexpr bool relocatable = is_trivially_relocatable_v<T>;
+
+        // Kept out of line so that checked accessors inline down to a compare and a cold branch.
+        // Under OXIDE_NO_EXCEPTIONS it panics instead, so no caller needs unwind tables.
+        [[noreturn]] OXIDE_NOINLINE OXIDE_COLD inline void throw_out_of_range(const char* msg) {
+#if defined(OXIDE_NO_EXCEPTIONS)
+            panic(msg);
+#else
+            throw std::out_of_range(msg);
+#endif
+        }
+
+        // Reports a failed infallible growth when OXIDE_PANIC_ON_ALLOC_FAILURE is defined
+        [[noreturn]] OXIDE_NOINLINE OXIDE_COLD inline void alloc_failure(const AllocError& error) {
+            panic(error.what());
+        }
+
+
+        /**
+         * @brief Resolves a drain argument to `[start, end)` indices. Accepts either a subrange
+         *        of the container's own iterators (as returned by iter_mut()) or an index range
+         *        such as std::views::iota(a, b).
+         */
+        template <typename Iter, typename R>
+        [[nodiscard]] auto drain_bounds(R& range, const Iter first) -> std::pair<size_t, size_t> {
+            if constexpr (std::is_same_v<std::ranges::iterator_t<R>, Iter>) {
+                return {static_cast<size_t>(std::ranges::begin(range) - first),
+                        static_cast<size_t>(std::ranges::end(range) - first)};
+            } else {
+                const auto start = static_cast<size_t>(*std::ranges::begin(range));
+                return {start, start + static_cast<size_t>(std::ranges::distance(range))};
+            }
+        }
+
+        /**
+         * @brief A view that moves the elements of `[start, end)` out of a container exactly once.
+         *        When the view is destroyed the whole range is removed, consumed or not,
+         *        and the tail is shifted down in a single relocation by the owner.
+         *
+         * @tparam Owner The container, which provides as_mut_ptr() and close_drain(start, end).
+         * @tparam T The element type.
+         */
+        template <typename Owner, typename T>
+        class Drain : public std::ranges::view_interface<Drain<Owner, T>> {
+        public:
+            Drain(Owner* owner, const size_t start, const size_t end) noexcept
+                : owner_(owner), start_(start), end_(end) {}
+
+            Drain(const Drain&) = delete;
+            Drain& operator=(const Drain&) = delete;
+
+            Drain(Drain&& other) noexcept
+                : owner_(std::exchange(other.owner_, nullptr)), start_(other.start_), end_(other.end_) {}
+
+            Drain& operator=(Drain&& other) noexcept {
+                if (this != &other) {
+                    finish();
+                    owner_ = std::exchange(other.owner_, nullptr);
+                    start_ = other.start_;
+                    end_ = other.end_;
+                }
+                return *this;
+            }
+
+            ~Drain() { finish(); }
+
+            [[nodiscard]] auto begin() const noexcept { return std::move_iterator<T*>(owner_->as_mut_ptr() + start_); }
+            [[nodiscard]] auto end() const noexcept { return std::move_iterator<T*>(owner_->as_mut_ptr() + end_); }
+
+        private:
+            void finish() noexcept {
+                if (owner_) {
+                    owner_->close_drain(start_, end_);
+                    owner_ = nullptr;
+                }
+            }
+
+            Owner* owner_;
+            size_t start_;
+            size_t end_;
+        };
+    }
+
     // Union type
     template <typename... Variants>
     using Union = std::variant<Variants...>;
@@ -67,10 +196,80 @@ namespace oxide {
     template <typename T, typename E = std::string>
     using Result = std::expected<T, E>;
 
-    // Vector type
-    template<typename T>
-    struct Vec : protected std::vector<T> {
-        using std::vector<T>::vector;  // Inherit all constructors
+    // Parallel iterator over a slice, defined after Vec (its collect() builds one)
+    template <typename T, typename Map = std::identity>
+    class ParIter;
+
+    // Vector type, generic over the allocator (see oxide::pmr::Vec for memory resources)
+    // and over the growth policy applied when it runs out of capacity (see oxide::growth)
+    template<typename T, typename Alloc = std::allocator<T>, typename Growth = growth::Std>
+    struct Vec : protected std::vector<T, Alloc> {
+        using std::vector<T, Alloc>::vector;  // Inherit all constructors
+        using typename std::vector<T, Alloc>::allocator_type;
+
+        Vec() = default;
+
+#if defined(OXIDE_PANIC_ON_ALLOC_FAILURE)
+        // Copies reserve through reserve_exact(), so a failed allocation panics like every other growth
+        Vec(const Vec& other)
+            : std::vector<T, Alloc>(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.get_allocator())) {
+            reserve_exact(other.size());
+            static_cast<std::vector<T, Alloc>&>(*this).insert(this->end(), other.begin(), other.end());
+        }
+
+        Vec(Vec&&) noexcept = default;
+
+        Vec& operator=(const Vec& other) {
+            if constexpr (std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value) {
+                if (this != &other) {
+                    Vec copy(other);
+                    static_cast<std::vector<T, Alloc>&>(*this) = std::move(static_cast<std::vector<T, Alloc>&>(copy));
+                }
+            } else if (this != &other) {
+                this->clear();
+                reserve_exact(other.size());
+                static_cast<std::vector<T, Alloc>&>(*this).insert(this->end(), other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        Vec& operator=(Vec&&) = default;
+#endif
+
+        /**
+         * @brief Takes over the buffer of a std::vector without copying any element.
+         *
+         * @param vec The vector whose buffer is adopted.
+         */
+        explicit Vec(std::vector<T, Alloc>&& vec) noexcept : std::vector<T, Alloc>(std::move(vec)) {}
+
+        /**
+         * @brief Releases the buffer as a std::vector without copying any element,
+         *        for APIs that take `std::vector&&`.
+         *
+         * @return The underlying std::vector; this Vec is left empty.
+         */
+        [[nodiscard]] auto into_vec() && noexcept -> std::vector<T, Alloc> {
+            return std::move(static_cast<std::vector<T, Alloc>&>(*this));
+        }
+
+        /**
+         * @brief Views the elements as a std::vector, for APIs that take `const std::vector&`.
+         *
+         * @return A const reference to the underlying std::vector.
+         */
+        [[nodiscard]] auto as_vec() const noexcept -> const std::vector<T, Alloc>& {
+            return *this;
+        }
+
+        /**
+         * @brief Returns a copy of the allocator used by the vector.
+         *
+         * @return The vector's allocator.
+         */
+        [[nodiscard]] auto allocator() const noexcept -> Alloc {
+            return this->get_allocator();
+        }
 
         /**
          * @brief Returns a const pointer to the vector's buffer.
@@ -94,12 +293,12 @@ namespace oxide {
          * @brief Removes all elements from the vector.
          */
         void clear() noexcept {
-            std::vector<T>::clear();
+            std::vector<T, Alloc>::clear();
         }
 
         /**
          * @brief Shortens the vector to the specified length, removing elements from the end.
-         *        If len >= current length, does nothing.
+         *        If len >= current length, does nothing. O(1) for trivially destructible T.
          *
          * @param len The new length of the vector.
          */
@@ -135,11 +334,10 @@ namespace oxide {
          * @throws std::out_of_range if the index is out of bounds.
          */
         [[nodiscard]] auto operator[](const size_t index) -> T& {
-            auto opt = get(index);
-            if (!opt) {
-                throw std::out_of_range("index out of bounds");
+            if (index >= this->size()) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
             }
-            return opt.value().get();
+            return this->data()[index];
         }
 
         /**
@@ -150,11 +348,33 @@ namespace oxide {
          * @throws std::out_of_range if the index is out of bounds.
          */
         [[nodiscard]] auto operator[](const size_t index) const -> const T& {
-            auto opt = get(index);
-            if (!opt) {
-                throw std::out_of_range("index out of bounds");
+            if (index >= this->size()) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
             }
-            return opt.value().get();
+            return this->data()[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index without bounds checking.
+         *        Intended for loops whose bounds are already proven, e.g. `i < len()`.
+         *
+         * @param index The index of the element to access (must be less than len()).
+         * @return A reference to the element at the given index.
+         * @warning Passing an out-of-bounds index is undefined behavior.
+         */
+        [[nodiscard]] auto get_unchecked(const size_t index) noexcept -> T& {
+            return this->data()[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index without bounds checking (const version).
+         *
+         * @param index The index of the element to access (must be less than len()).
+         * @return A const reference to the element at the given index.
+         * @warning Passing an out-of-bounds index is undefined behavior.
+         */
+        [[nodiscard]] auto get_unchecked(const size_t index) const noexcept -> const T& {
+            return this->data()[index];
         }
 
         /**
@@ -187,13 +407,13 @@ namespace oxide {
          * @param index The index of the element to retrieve.
          * @return An Option containing a reference to the element at the given index
          *         if the index is within bounds (less than the size of the vector),
-         *         otherwise None.
+         *         otherwise None. The Option is pointer-sized.
          */
-        [[nodiscard]] auto get(size_t index) -> Option<std::reference_wrapper<T>> {
+        [[nodiscard]] auto get(size_t index) noexcept -> Option<T&> {
             if (index < this->size()) {
-                return Some(std::ref(this->data()[index]));
+                return Option<T&>(this->data()[index]);
             }
-            return None<std::reference_wrapper<T>>();
+            return Option<T&>(_none);
         }
 
         /**
@@ -202,13 +422,13 @@ namespace oxide {
          * @param index The index of the element to retrieve.
          * @return An Option containing a const reference to the element at the given index
          *         if the index is within bounds (less than the size of the vector),
-         *         otherwise None.
+         *         otherwise None. The Option is pointer-sized.
          */
-        [[nodiscard]] auto get(size_t index) const -> Option<std::reference_wrapper<const T>> {
+        [[nodiscard]] auto get(size_t index) const noexcept -> Option<const T&> {
             if (index < this->size()) {
-                return Some(std::cref(this->data()[index]));
+                return Option<const T&>(this->data()[index]);
             }
-            return None<std::reference_wrapper<const T>>();
+            return Option<const T&>(_none);
         }
 
         /**
@@ -217,9 +437,71 @@ namespace oxide {
          * @param value The value to append (moved into the vector).
          */
         void push(T value) {
+            grow_for(1);
             this->push_back(std::move(value));
         }
 
+        /**
+         * @brief Appends copies of all elements of `slice` to the back of the vector,
+         *        reserving once. For trivially copyable T this is a single memcpy.
+         *        The slice may refer to this vector's own elements.
+         *
+         * @param slice The elements to copy.
+         */
+        void extend_from_slice(std::span<const T> slice) {
+            const size_t len = this->size();
+            const size_t count = slice.size();
+            const T* data = this->data();
+            const bool aliased = !slice.empty() && slice.data() >= data && slice.data() < data + len;
+            const size_t offset = aliased ? static_cast<size_t>(slice.data() - data) : 0;
+            grow_for(count);
+            if (aliased) {
+                if (count > capacity() - len) {
+                    static_cast<std::vector<T, Alloc>&>(*this).reserve(std::max(len + count, 2 * len));
+                }
+                if constexpr (detail::bitwise_copyable<T>) {
+                    // No reallocation can happen now, so the source is rebased once and copied into
+                    // [len, len + count), which it never overlaps, as one memmove like the unaliased path
+                    const T* source = this->data() + offset;
+                    std::vector<T, Alloc>::insert(this->end(), source, source + count);
+                } else {
+                    for (size_t i = 0; i < count; ++i) {
+                        this->push_back(this->data()[offset + i]);  // Capacity is reserved, no reallocation
+                    }
+                }
+            } else {
+                // Uninitialized range copy, lowered to one memmove for trivially copyable T
+                std::vector<T, Alloc>::insert(this->end(), slice.data(), slice.data() + count);
+            }
+        }
+
+        /**
+         * @brief Appends every element of `range` to the back of the vector. Sized ranges
+         *        reserve once up front, contiguous ranges of T are copied like extend_from_slice().
+         *        Elements are moved when the range yields rvalues.
+         *
+         * @param range The elements to append; only contiguous ranges may refer to this vector.
+         */
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        void extend(R&& range) {
+            using Ref = std::ranges::range_reference_t<R>;
+            if constexpr (std::ranges::contiguous_range<R> && std::is_lvalue_reference_v<Ref> &&
+                          std::same_as<std::remove_cvref_t<Ref>, T>) {
+                extend_from_slice(std::span<const T>(std::ranges::data(range), std::ranges::size(range)));
+            } else if constexpr (std::ranges::sized_range<R>) {
+                grow_for(static_cast<size_t>(std::ranges::size(range)));
+                for (auto&& value : range) {
+                    this->emplace_back(std::forward<decltype(value)>(value));  // Capacity is reserved
+                }
+            } else {
+                for (auto&& value : range) {
+                    grow_for(1);
+                    this->emplace_back(std::forward<decltype(value)>(value));
+                }
+            }
+        }
+
         /**
          * @brief Inserts an element at the specified position in the vector.
          *        Throws if the index is greater than the current length.
@@ -230,9 +512,72 @@ namespace oxide {
          */
         void insert(size_t index, T value) {
             if (index > this->size()) {
-                throw std::out_of_range("insert index out of bounds");
+                detail::throw_out_of_range("insert index out of bounds");
+            }
+            grow_for(1);
+            if constexpr (detail::bitwise_copyable<T>) {
+                const size_t len = this->size();
+                this->push_back(value);
+                T* data = this->data();
+                std::memmove(data + index + 1, data + index, (len - index) * sizeof(T));
+                std::memcpy(data + index, &value, sizeof(T));
+            } else if constexpr (detail::relocatable<T>) {
+                const size_t len = this->size();
+                this->push_back(std::move(value));
+                detail::relocate_rotate_right(this->data() + index, len - index);
+            } else {
+                std::vector<T, Alloc>::insert(this->begin() + index, std::move(value));
+            }
+        }
+
+        /**
+         * @brief Inserts all elements of `range` at the specified position, reserving once and
+         *        shifting the tail a single time, so a batch of k elements costs O(k + len()).
+         *        Unsized single-pass ranges are collected into a temporary first.
+         *
+         * @param index The position at which to insert the elements (0 <= index <= len()).
+         * @param range The elements to insert; only contiguous ranges may refer to this vector.
+         * @throws std::out_of_range if index > len().
+         */
+        template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        void insert_many(size_t index, R&& range) {
+            if (index > this->size()) [[unlikely]] {
+                detail::throw_out_of_range("insert_many index out of bounds");
+            }
+            if constexpr (!std::ranges::forward_range<R> && !std::ranges::sized_range<R>) {
+                Vec buffer(this->get_allocator());
+                buffer.extend(std::forward<R>(range));
+                insert_many(index, std::ranges::subrange(std::make_move_iterator(buffer.begin()),
+                                                         std::make_move_iterator(buffer.end())));
+            } else {
+                // Only a range of T can be part of this vector
+                if constexpr (std::ranges::contiguous_range<R> &&
+                              std::same_as<std::remove_cv_t<std::ranges::range_value_t<R>>, T>) {
+                    const T* first = std::to_address(std::ranges::begin(range));
+                    if (!std::less<const T*>{}(first, this->data()) && std::less<const T*>{}(first, this->data() + this->size())) {
+                        // The range is part of this vector and would move when it grows
+                        Vec copy(this->get_allocator());
+                        copy.extend(range);
+                        insert_many(index, std::ranges::subrange(std::make_move_iterator(copy.begin()),
+                                                                 std::make_move_iterator(copy.end())));
+                        return;
+                    }
+                }
+                const auto count = static_cast<size_t>(std::ranges::distance(range));
+                if (count == 0) {
+                    return;
+                }
+                grow_for(count);
+                if constexpr (detail::relocatable<T> && !detail::bitwise_copyable<T>) {
+                    insert_relocating(index, count, range);
+                } else {
+                    // One tail shift (a memmove for trivially copyable T), then the new elements
+                    auto common = std::views::common(std::views::all(std::forward<R>(range)));
+                    std::vector<T, Alloc>::insert(this->begin() + static_cast<std::ptrdiff_t>(index),
+                                                  std::ranges::begin(common), std::ranges::end(common));
+                }
             }
-            std::vector<T>::insert(this->begin() + index, std::move(value));
         }
 
         /**
@@ -245,13 +590,115 @@ namespace oxide {
          */
         [[nodiscard]] auto remove(size_t index) -> T {
             if (index >= this->size()) {
-                throw std::out_of_range("remove index out of bounds");
+                detail::throw_out_of_range("remove index out of bounds");
+            }
+            T* data = this->data();
+            T value = std::move(data[index]);
+            if constexpr (detail::bitwise_copyable<T>) {
+                std::memmove(data + index, data + index + 1, (this->size() - index - 1) * sizeof(T));
+                this->pop_back();
+            } else if constexpr (detail::relocatable<T>) {
+                // The moved-from element travels to the back and is destroyed there
+                detail::relocate_rotate_left(data + index, this->size() - index - 1);
+                this->pop_back();
+            } else {
+                this->erase(this->begin() + index);
+            }
+            return value;
+        }
+
+        /**
+         * @brief Removes the element at the specified position and returns it,
+         *        replacing it with the last element. This does not preserve ordering but is O(1).
+         *
+         * @param index The index of the element to remove (0 <= index < len()).
+         * @return The removed element (moved out).
+         * @throws std::out_of_range if index >= len().
+         */
+        [[nodiscard]] auto swap_remove(size_t index) -> T {
+            if (index >= this->size()) [[unlikely]] {
+                detail::throw_out_of_range("swap_remove index out of bounds");
             }
-            T value = std::move((*this)[index]);
-            this->erase(this->begin() + index);
+            T* data = this->data();
+            const size_t last = this->size() - 1;
+            T value = std::move(data[index]);
+            if (index != last) {
+                data[index] = std::move(data[last]);
+            }
+            this->pop_back();
             return value;
         }
 
+        /**
+         * @brief Removes the elements at all of the given positions without preserving ordering.
+         *        Holes are filled from the end of the vector in one pass and the vacated tail
+         *        is destroyed in a single truncation. Duplicate indices are removed once.
+         *        Validates every index before modifying the vector.
+         *
+         * @param indices A range of positions to remove (each < len()), in any order.
+         * @return The number of elements removed.
+         * @throws std::out_of_range if any index >= len().
+         */
+        template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, size_t>
+        auto swap_remove_many(R&& indices) -> size_t {
+            std::vector<size_t> order;
+            if constexpr (std::ranges::sized_range<R>) {
+                order.reserve(std::ranges::size(indices));
+            }
+            for (auto&& index : indices) {
+                order.push_back(static_cast<size_t>(index));
+            }
+            std::ranges::sort(order, std::ranges::greater{});
+            const auto unique_end = std::ranges::unique(order).begin();
+            order.erase(unique_end, order.end());
+            if (!order.empty() && order.front() >= this->size()) [[unlikely]] {
+                detail::throw_out_of_range("swap_remove_many index out of bounds");
+            }
+            // Descending order guarantees the current last element is never itself pending removal
+            T* data = this->data();
+            size_t len = this->size();
+            for (const size_t index : order) {
+                --len;
+                if (index != len) {
+                    data[index] = std::move(data[len]);
+                }
+            }
+            this->erase(this->begin() + static_cast<std::ptrdiff_t>(len), this->end());
+            return order.size();
+        }
+
+        /**
+         * @brief Keeps only the elements for which `keep` returns true, preserving their order.
+         *        Compacts in a single pass, moving each survivor at most once.
+         *        If `keep` throws, the elements already rejected stay removed and every
+         *        unvisited element is kept; no moved-from element is left in the vector.
+         *
+         * @param keep A predicate taking `const T&`.
+         */
+        template <typename F>
+        requires std::predicate<F&, const T&>
+        void retain(F&& keep) {
+            retain_mut([&keep](T& value) { return std::invoke(keep, std::as_const(value)); });
+        }
+
+        /**
+         * @brief Like retain(), but the predicate may mutate the elements it visits.
+         *
+         * @param keep A predicate taking `T&`.
+         */
+        template <typename F>
+        requires std::predicate<F&, T&>
+        void retain_mut(F&& keep) {
+            Compactor compactor(*this);
+            T* data = this->data();
+            for (; compactor.read < compactor.len; ++compactor.read) {
+                if (std::invoke(keep, data[compactor.read])) {
+                    compactor.keep(data);
+                }
+            }
+        }
+
         /**
          * @brief Checks if the vector contains no elements.
          *
@@ -267,17 +714,130 @@ namespace oxide {
          * @return The capacity of the vector as a size_t.
          */
         [[nodiscard]] size_t capacity() const noexcept {
-            return static_cast<const std::vector<T>&>(*this).capacity();
+            return static_cast<const std::vector<T, Alloc>&>(*this).capacity();
         }
 
         /**
          * @brief Reserves capacity for at least `additional` more elements.
-         *        May reallocate if current capacity is insufficient.
+         *        May reallocate if current capacity is insufficient, in which case
+         *        a custom growth policy may round the new capacity up.
          *
          * @param additional The number of additional elements to reserve space for.
          */
         void reserve(size_t additional) {
-            static_cast<std::vector<T>&>(*this).reserve(this->size() + additional);
+#if defined(OXIDE_PANIC_ON_ALLOC_FAILURE)
+            if (const auto reserved = try_reserve(additional); !reserved) [[unlikely]] {
+                detail::alloc_failure(reserved.error());
+            }
+#else
+            if constexpr (growth::custom<Growth>) {
+                grow_for(additional);
+            } else {
+                static_cast<std::vector<T, Alloc>&>(*this).reserve(this->size() + additional);
+            }
+#endif
+        }
+
+        /**
+         * @brief Reserves capacity for exactly `additional` more elements,
+         *        bypassing the growth policy.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         */
+        void reserve_exact(size_t additional) {
+#if defined(OXIDE_PANIC_ON_ALLOC_FAILURE)
+            if (const auto reserved = try_reserve_exact(additional); !reserved) [[unlikely]] {
+                detail::alloc_failure(reserved.error());
+            }
+#else
+            static_cast<std::vector<T, Alloc>&>(*this).reserve(this->size() + additional);
+#endif
+        }
+
+        /**
+         * @brief Like reserve(), but reports failure instead of throwing std::bad_alloc.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         * @return Ok, or Err(AllocError) if the capacity overflows or the allocator fails;
+         *         the vector is unchanged on error.
+         */
+        [[nodiscard]] auto try_reserve(const size_t additional) -> Result<void, AllocError> {
+            return try_grow_for(additional, false);
+        }
+
+        /**
+         * @brief Like reserve_exact(), but reports failure instead of throwing std::bad_alloc.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         * @return Ok, or Err(AllocError); the vector is unchanged on error.
+         */
+        [[nodiscard]] auto try_reserve_exact(const size_t additional) -> Result<void, AllocError> {
+            if (additional > this->max_size() - this->size()) {
+                return std::unexpected(AllocError{AllocError::Kind::CapacityOverflow, 0});
+            }
+            return try_grow_to(this->size() + additional);
+        }
+
+        /**
+         * @brief Like push(), but reports failure instead of throwing std::bad_alloc.
+         *
+         * @param value The value to append; dropped if the vector cannot grow.
+         * @return Ok, or Err(AllocError); the vector is unchanged on error.
+         */
+        [[nodiscard]] auto try_push(T value) -> Result<void, AllocError> {
+            if (const auto grown = try_grow_for(1, true); !grown) [[unlikely]] {
+                return grown;
+            }
+            this->push_back(std::move(value));  // Capacity is reserved, no reallocation
+            return {};
+        }
+
+        /**
+         * @brief Creates an empty vector with room for exactly `capacity` elements.
+         *
+         * @param capacity The number of elements to reserve space for.
+         * @param alloc The allocator to use.
+         * @return Ok with the vector, or Err(AllocError) if the memory cannot be allocated.
+         */
+        [[nodiscard]] static auto try_with_capacity(const size_t capacity, const Alloc& alloc = Alloc())
+            -> Result<Vec, AllocError>
+        {
+            Vec vec(alloc);
+            if (const auto reserved = vec.try_reserve_exact(capacity); !reserved) {
+                return std::unexpected(reserved.error());
+            }
+            return vec;
+        }
+
+        /**
+         * @brief Returns the spare capacity after the last element as a mutable span,
+         *        so producers (read(2), decoders) can write into it directly.
+         *        Follow up with set_len() to make the written elements part of the vector,
+         *        so like set_len() it requires a DefaultInitAllocator.
+         *
+         * @return A std::span<T> over [len(), capacity()); its contents are uninitialized.
+         */
+        [[nodiscard]] auto spare_capacity_mut() noexcept -> std::span<T>
+            requires is_default_init_allocator<Alloc>::value && std::is_trivially_default_constructible_v<T> &&
+                     std::is_trivially_destructible_v<T>
+        {
+            return std::span<T>(this->data() + this->size(), capacity() - this->size());
+        }
+
+        /**
+         * @brief Forces the length of the vector to `new_len` without initializing or destroying
+         *        anything. Requires a DefaultInitAllocator, so growing the length keeps the bytes
+         *        already written through spare_capacity_mut() instead of zeroing them.
+         *
+         * @param new_len The new length (must be <= capacity()).
+         * @warning Unsafe: every element in [len(), new_len) must have been written before,
+         *          and `new_len` above capacity() is undefined behavior.
+         */
+        void set_len(size_t new_len) noexcept
+            requires is_default_init_allocator<Alloc>::value && std::is_trivially_default_constructible_v<T> &&
+                     std::is_trivially_destructible_v<T>
+        {
+            this->resize(new_len);  // Default-initialization of trivial T is a no-op
         }
 
         /**
@@ -285,7 +845,7 @@ namespace oxide {
          *        This is a non-binding request; the capacity may not change.
          */
         void shrink_to_fit() noexcept {
-            static_cast<std::vector<T>&>(*this).shrink_to_fit();
+            static_cast<std::vector<T, Alloc>&>(*this).shrink_to_fit();
         }
 
         /**
@@ -293,7 +853,7 @@ namespace oxide {
          *
          * @return A subrange representing the const view of the vector.
          */
-        [[nodiscard]] auto iter() const noexcept -> std::ranges::subrange<typename std::vector<T>::const_iterator> {
+        [[nodiscard]] auto iter() const noexcept -> std::ranges::subrange<typename std::vector<T, Alloc>::const_iterator> {
             return std::ranges::subrange(this->cbegin(), this->cend());
         }
 
@@ -302,144 +862,1584 @@ namespace oxide {
          *
          * @return A subrange representing the mutable view of the vector.
          */
-        [[nodiscard]] auto iter_mut() noexcept -> std::ranges::subrange<typename std::vector<T>::iterator> {
+        [[nodiscard]] auto iter_mut() noexcept -> std::ranges::subrange<typename std::vector<T, Alloc>::iterator> {
             return std::ranges::subrange(this->begin(), this->end());
         }
 
         /**
-         * @brief An iterator that allows draining elements from a container,
-         *        consuming the container as it iterates.
+         * @brief Returns a parallel iterator over the elements, run on ThreadPool::global().
+         *
+         * @return A ParIter yielding const references.
          */
-        class DrainIterator;
+        [[nodiscard]] auto par_iter() const noexcept -> ParIter<const T> {
+            return ParIter<const T>(as_slice());
+        }
 
         /**
-         * @brief A sentinel structure used to indicate the end of a drain operation.
+         * @brief Returns a parallel iterator over mutable elements, run on ThreadPool::global().
          *
-         * DrainSentinel serves as a marker or terminator in contexts where draining
-         * resources or data streams is required, ensuring safe and controlled termination.
+         * @return A ParIter yielding mutable references.
          */
-        struct DrainSentinel;
-
-        friend bool operator==(const DrainIterator& it, const DrainSentinel& sent) noexcept {
-            return it.vec_ == sent.vec_ && it.index_ == sent.end_;
+        [[nodiscard]] auto par_iter_mut() noexcept -> ParIter<T> {
+            return ParIter<T>(as_mut_slice());
         }
 
-        friend bool operator!=(const DrainIterator& it, const DrainSentinel& sent) noexcept {
-            return !(it == sent);
+        /**
+         * @brief Returns a view over consecutive chunks of `size` elements; the last chunk is
+         *        shorter when `size` does not divide the length. No allocation is performed.
+         *
+         * @param size The number of elements per chunk.
+         * @return A random-access view of std::span<const T>.
+         * @note Panics if `size` is zero.
+         */
+        [[nodiscard]] auto chunks(const size_t size) const -> Chunks<const T> {
+            return make_chunks<const T>(as_slice(), size, false);
         }
 
-        friend std::ptrdiff_t operator-(const DrainSentinel& sent, const DrainIterator& it) noexcept {
-            return static_cast<std::ptrdiff_t>(sent.end_ - it.index_);
+        /**
+         * @brief Mutable counterpart of chunks().
+         *
+         * @param size The number of elements per chunk.
+         * @return A random-access view of std::span<T>.
+         * @note Panics if `size` is zero.
+         */
+        [[nodiscard]] auto chunks_mut(const size_t size) -> Chunks<T> {
+            return make_chunks<T>(as_mut_slice(), size, false);
         }
 
-        friend std::ptrdiff_t operator-(const DrainIterator& it, const DrainSentinel& sent) noexcept {
-            return -(sent - it);
+        /**
+         * @brief Returns a view over consecutive chunks of exactly `size` elements. The trailing
+         *        `len() % size` elements are not yielded; they are available through remainder(),
+         *        so the loop body never has to handle a short chunk.
+         *
+         * @param size The number of elements per chunk.
+         * @return A random-access view of std::span<const T>.
+         * @note Panics if `size` is zero.
+         */
+        [[nodiscard]] auto chunks_exact(const size_t size) const -> Chunks<const T> {
+            return make_chunks<const T>(as_slice(), size, true);
         }
 
         /**
-         * @brief An iterator that drains elements from a container by transferring ownership.
+         * @brief Mutable counterpart of chunks_exact().
+         *
+         * @param size The number of elements per chunk.
+         * @return A random-access view of std::span<T>.
+         * @note Panics if `size` is zero.
          */
-        class DrainIterator {
-        public:
-            using iterator_category = std::input_iterator_tag;
-            using value_type = T;
-            using difference_type = std::ptrdiff_t;
-            using pointer = T*;
-            using reference = T&&;
+        [[nodiscard]] auto chunks_exact_mut(const size_t size) -> Chunks<T> {
+            return make_chunks<T>(as_mut_slice(), size, true);
+        }
 
-            DrainIterator() = delete;
-            DrainIterator(Vec* vec, const size_t start, size_t end)
-                : vec_(vec), start_(start), index_(start), end_(end) {
-                if (start > end || end > vec_->size()) {
-                    throw std::out_of_range("drain range out of bounds");
-                }
-            }
+        /**
+         * @brief Returns a view over every overlapping window of `size` elements, e.g. [1, 2, 3]
+         *        yields [1, 2] and [2, 3]. Yields nothing when `size` exceeds the length.
+         *
+         * @param size The number of elements per window.
+         * @return A random-access view of std::span<const T>.
+         * @note Panics if `size` is zero.
+         */
+        [[nodiscard]] auto windows(const size_t size) const -> Chunks<const T> {
+            if (size == 0) [[unlikely]] panic("window size must be non-zero");
+            const size_t count = this->size() >= size ? this->size() - size + 1 : 0;
+            return Chunks<const T>(as_slice(), size, 1, count);
+        }
 
-            DrainIterator(const DrainIterator&) = delete;
-            DrainIterator& operator=(const DrainIterator&) = delete;
+        /**
+         * @brief Returns a view over consecutive chunks of exactly N elements, each a std::span<const T, N>.
+         *        The chunk length is a compile-time constant, so loops over a chunk can be fully
+         *        unrolled and vectorized. Leftover elements are available through remainder().
+         *
+         * @tparam N The number of elements per chunk.
+         * @return A random-access view of std::span<const T, N>.
+         */
+        template <size_t N>
+        [[nodiscard]] auto as_chunks() const noexcept -> Chunks<const T, N> {
+            static_assert(N > 0, "chunk size must be non-zero");
+            return Chunks<const T, N>(as_slice(), N, N, this->size() / N);
+        }
 
-            DrainIterator(DrainIterator&& other) noexcept
-                : vec_(other.vec_), start_(other.start_), index_(other.index_), end_(other.end_) {
-                other.vec_ = nullptr;
-            }
+        /**
+         * @brief Mutable counterpart of as_chunks().
+         *
+         * @tparam N The number of elements per chunk.
+         * @return A random-access view of std::span<T, N>.
+         */
+        template <size_t N>
+        [[nodiscard]] auto as_chunks_mut() noexcept -> Chunks<T, N> {
+            static_assert(N > 0, "chunk size must be non-zero");
+            return Chunks<T, N>(as_mut_slice(), N, N, this->size() / N);
+        }
 
-            DrainIterator& operator=(DrainIterator&& other) noexcept {
-                if (this != &other) {
-                    this->~DrainIterator();  // Erase if this was active
-                    vec_ = other.vec_;
-                    start_ = other.start_;
-                    index_ = other.index_;
-                    end_ = other.end_;
-                    other.vec_ = nullptr;
+        /**
+         * @brief Sorts the vector in ascending order without preserving the order of equal elements.
+         *        Integer and floating-point elements use an LSD radix sort; floats follow the
+         *        IEEE-754 total order at every length, so NaNs sort to the ends instead of breaking the sort.
+         */
+        void sort_unstable() requires std::totally_ordered<T> {
+            if constexpr (detail::radix_key<T>) {
+                if (this->size() >= detail::radix_threshold) {
+                    radix_sort_elements([](const T& value) { return detail::radix_bits(value); });
+                    return;
                 }
-                return *this;
             }
+            std::sort(this->begin(), this->end(), detail::sort_less<T>{});
+        }
 
-            T&& operator*() {
-                return std::move((*vec_)[index_]);
-            }
+        /**
+         * @brief Sorts the vector with a comparator, without preserving the order of equal elements.
+         *
+         * @param compare A strict weak ordering, `compare(a, b)` is true if a goes before b.
+         */
+        template <typename F>
+        requires std::strict_weak_order<F&, const T&, const T&>
+        void sort_unstable_by(F&& compare) {
+            std::sort(this->begin(), this->end(), std::ref(compare));
+        }
 
-            DrainIterator& operator++() {
-                ++index_;
-                return *this;
+        /**
+         * @brief Sorts the vector by the key extracted from each element.
+         *        Integer and floating-point keys use an LSD radix sort over (key, index) pairs
+         *        followed by a single permutation pass, so every element is moved once.
+         *
+         * @param key Maps `const T&` to a totally ordered key; may be called more than once per element.
+         */
+        template <typename F>
+        requires std::invocable<F&, const T&> && std::totally_ordered<std::remove_cvref_t<std::invoke_result_t<F&, const T&>>>
+        void sort_unstable_by_key(F&& key) {
+            using K = std::remove_cvref_t<std::invoke_result_t<F&, const T&>>;
+            if constexpr (detail::radix_key<K>) {
+                if (this->size() >= detail::radix_threshold) {
+                    if constexpr (detail::bitwise_copyable<T> && sizeof(T) <= 2 * sizeof(size_t)) {
+                        radix_sort_elements([&key](const T& value) { return detail::radix_bits(std::invoke(key, value)); });
+                    } else {
+                        radix_sort_by_key(key);
+                    }
+                    return;
+                }
             }
+            std::sort(this->begin(), this->end(), [&key](const T& a, const T& b) {
+                return detail::sort_less<K>{}(std::invoke(key, a), std::invoke(key, b));
+            });
+        }
 
-            DrainIterator operator++(int) {
-                DrainIterator tmp = *this;
-                ++index_;
-                return tmp;
+        /**
+         * @brief Sorts the vector by a key that is computed exactly once per element,
+         *        for keys that are expensive to compute. The sort is stable.
+         *
+         * @param key Maps `const T&` to a totally ordered key.
+         */
+        template <typename F>
+        requires std::invocable<F&, const T&> && std::totally_ordered<std::remove_cvref_t<std::invoke_result_t<F&, const T&>>>
+        void sort_by_cached_key(F&& key) {
+            using K = std::remove_cvref_t<std::invoke_result_t<F&, const T&>>;
+            const size_t len = this->size();
+            if (len < 2) {
+                return;
             }
-
-            friend bool operator==(const DrainIterator& a, const DrainIterator& b) noexcept {
-                return a.vec_ == b.vec_ && a.index_ == b.index_;
+            if constexpr (detail::radix_key<K>) {
+                radix_sort_by_key(key);
+            } else {
+                std::vector<std::pair<K, size_t>> keyed;
+                keyed.reserve(len);
+                for (size_t i = 0; i < len; ++i) {
+                    keyed.emplace_back(std::invoke(key, this->data()[i]), i);
+                }
+                std::sort(keyed.begin(), keyed.end());  // Ties fall back to the index, keeping it stable
+                std::vector<size_t> order;
+                order.reserve(len);
+                for (const auto& entry : keyed) {
+                    order.push_back(entry.second);
+                }
+                apply_order(order);
             }
+        }
 
-            ~DrainIterator() {
-                if (vec_) {
-                    vec_->erase(vec_->begin() + start_, vec_->begin() + end_);
-                    vec_ = nullptr;
+        /**
+         * @brief Sorts the vector in ascending order on ThreadPool::global(). The range is split
+         *        into per-thread chunks, each chunk is sorted (radix sort for integer and
+         *        floating-point elements) and the chunks are merged pairwise in parallel.
+         *        Floats follow the same IEEE-754 total order as sort_unstable().
+         */
+        void par_sort() requires std::totally_ordered<T> {
+            detail::parallel_sort(ThreadPool::global(), this->data(), this->size(), detail::sort_less<T>{}, [](T* first, T* last) {
+                if constexpr (detail::radix_key<T>) {
+                    const auto n = static_cast<size_t>(last - first);
+                    if (n >= detail::radix_threshold) {
+                        std::vector<T> scratch(n);
+                        detail::radix_sort(first, n, scratch.data(), [](const T& value) { return detail::radix_bits(value); });
+                        return;
+                    }
                 }
-            }
+                std::sort(first, last, detail::sort_less<T>{});
+            });
+        }
 
-        private:
-            Vec* vec_;
-            size_t start_;
-            size_t index_;
-            size_t end_;
+        /**
+         * @brief Sorts the vector with a comparator on ThreadPool::global().
+         *        The comparator is invoked concurrently and must be safe to share between threads.
+         *
+         * @param compare A strict weak ordering, `compare(a, b)` is true if a goes before b.
+         */
+        template <typename F>
+        requires std::strict_weak_order<const F&, const T&, const T&>
+        void par_sort_by(const F& compare) {
+            detail::parallel_sort(ThreadPool::global(), this->data(), this->size(), std::cref(compare), [&compare](T* first, T* last) {
+                std::sort(first, last, std::cref(compare));
+            });
+        }
+
+        /**
+         * @brief Binary searches this sorted vector for `value`.
+         *
+         * @param value The value to look for.
+         * @return Ok with the index of a matching element (any of them if there are several),
+         *         or Err with the index where `value` could be inserted to keep the order.
+         */
+        [[nodiscard]] auto binary_search(const T& value) const -> Result<size_t, size_t>
+            requires std::totally_ordered<T>
+        {
+            return binary_search_by([&value](const T& probe) { return detail::weak_compare(probe, value); });
+        }
+
+        /**
+         * @brief Binary searches this sorted vector with a comparator. The loop is branchless
+         *        (the halving step compiles to a conditional move), so its cost does not depend
+         *        on branch prediction.
+         *
+         * @param f Returns the ordering of the probed element relative to the target,
+         *          e.g. `probe <=> target`.
+         * @return Ok with the index of a matching element, or Err with the insertion index.
+         */
+        template <typename F>
+        requires std::invocable<F&, const T&>
+        [[nodiscard]] auto binary_search_by(F&& f) const -> Result<size_t, size_t> {
+            const T* data = this->data();
+            size_t size = this->size();
+            if (size == 0) {
+                return std::unexpected(size_t{0});
+            }
+            size_t base = 0;
+            while (size > 1) {
+                const size_t half = size / 2;
+                const size_t mid = base + half;
+                base = std::invoke(f, data[mid]) > 0 ? base : mid;
+                size -= half;
+            }
+            const auto order = std::invoke(f, data[base]);
+            if (order == 0) {
+                return base;
+            }
+            return std::unexpected(base + static_cast<size_t>(order < 0));
+        }
+
+        /**
+         * @brief Binary searches this vector, sorted by `f`, for the element whose key equals `key`.
+         *
+         * @param key The key to look for.
+         * @param f Maps `const T&` to its key.
+         * @return Ok with the index of a matching element, or Err with the insertion index.
+         */
+        template <typename K, typename F>
+        requires std::invocable<F&, const T&>
+        [[nodiscard]] auto binary_search_by_key(const K& key, F&& f) const -> Result<size_t, size_t> {
+            return binary_search_by([&](const T& probe) { return detail::weak_compare(std::invoke(f, probe), key); });
+        }
+
+        /**
+         * @brief Returns true if the vector contains an element equal to `value`. Integer and
+         *        floating-point elements are scanned with the widest SIMD kernel the CPU supports.
+         *
+         * @param value The value to look for.
+         */
+        [[nodiscard]] bool contains(const T& value) const requires std::equality_comparable<T> {
+            return position(value).has_value();
+        }
+
+        /**
+         * @brief Returns the index of the first element equal to `value` (SIMD for arithmetic T).
+         *
+         * @param value The value to look for; a NaN never matches.
+         * @return Some(index), or None if there is no match.
+         */
+        [[nodiscard]] auto position(const T& value) const -> Option<size_t> requires std::equality_comparable<T> {
+            size_t index;
+            if constexpr (simd::element<T>) {
+                index = simd::position(as_slice(), value);
+            } else {
+                index = static_cast<size_t>(std::ranges::find(as_slice(), value) - as_slice().begin());
+            }
+            return index < this->size() ? Option<size_t>(index) : Option<size_t>();
+        }
+
+        /**
+         * @brief Returns the index of the last element equal to `value` (SIMD for arithmetic T).
+         *
+         * @param value The value to look for; a NaN never matches.
+         * @return Some(index), or None if there is no match.
+         */
+        [[nodiscard]] auto rposition(const T& value) const -> Option<size_t> requires std::equality_comparable<T> {
+            if constexpr (simd::element<T>) {
+                const size_t index = simd::rposition(as_slice(), value);
+                return index < this->size() ? Option<size_t>(index) : Option<size_t>();
+            } else {
+                for (size_t i = this->size(); i > 0; --i) {
+                    if (get_unchecked(i - 1) == value) {
+                        return Option<size_t>(i - 1);
+                    }
+                }
+                return Option<size_t>();
+            }
+        }
+
+        /**
+         * @brief Returns the number of elements equal to `value` (SIMD for arithmetic T).
+         *
+         * @param value The value to count; a NaN never matches.
+         */
+        [[nodiscard]] size_t count(const T& value) const requires std::equality_comparable<T> {
+            if constexpr (simd::element<T>) {
+                return simd::count(as_slice(), value);
+            } else {
+                return static_cast<size_t>(std::ranges::count(as_slice(), value));
+            }
+        }
+
+        /**
+         * @brief Returns the smallest element (SIMD for arithmetic T). Floating-point NaNs are ignored.
+         *
+         * @return Some(the minimum), or None if the vector is empty (or holds only NaNs).
+         */
+        [[nodiscard]] auto min() const -> Option<T> requires std::totally_ordered<T> && std::copy_constructible<T> {
+            return extremum<false>();
+        }
+
+        /**
+         * @brief Returns the largest element (SIMD for arithmetic T). Floating-point NaNs are ignored.
+         *
+         * @return Some(the maximum), or None if the vector is empty (or holds only NaNs).
+         */
+        [[nodiscard]] auto max() const -> Option<T> requires std::totally_ordered<T> && std::copy_constructible<T> {
+            return extremum<true>();
+        }
+
+        /**
+         * @brief Returns the sum of the elements (SIMD for arithmetic T), or zero if the vector is empty.
+         *        Integer sums wrap around on overflow; floating-point sums are accumulated in several
+         *        lanes, so the last bits can differ from a sequential loop.
+         */
+        [[nodiscard]] T sum() const requires std::is_arithmetic_v<T> {
+            if constexpr (simd::element<T>) {
+                return simd::sum(as_slice());
+            } else {
+                return std::accumulate(this->begin(), this->end(), T{});
+            }
+        }
+
+        /**
+         * @brief A view that moves drained elements out and removes them from the vector when destroyed.
+         */
+        using Drain = detail::Drain<Vec, T>;
+
+        /**
+         * @brief Moves all elements of `other` to the back of this vector, leaving `other` empty.
+         *        Steals the buffer when this vector is empty, otherwise relocates in one bulk move.
+         *
+         * @param other The vector to move the elements from.
+         */
+        void append(Vec& other) {
+            other.drain_into(*this);
+        }
+
+        /**
+         * @brief Splits the vector in two at the given index. This vector keeps `[0, at)`
+         *        and the returned one receives `[at, len())`, moved in one bulk relocation.
+         *        Splitting at 0 hands over the whole buffer without moving any element.
+         *
+         * @param at The index to split at (0 <= at <= len()).
+         * @return A new Vec with the tail elements, using a copy of this vector's allocator.
+         * @throws std::out_of_range if at > len().
+         */
+        [[nodiscard]] auto split_off(size_t at) -> Vec {
+            if (at > this->size()) [[unlikely]] {
+                detail::throw_out_of_range("split_off index out of bounds");
+            }
+            Vec tail(this->get_allocator());
+            if (at == 0) {
+                static_cast<std::vector<T, Alloc>&>(tail).swap(*this);
+                return tail;
+            }
+            tail.reserve_exact(this->size() - at);
+            static_cast<std::vector<T, Alloc>&>(tail).insert(tail.end(), std::make_move_iterator(this->begin() + static_cast<std::ptrdiff_t>(at)),
+                                                             std::make_move_iterator(this->end()));
+            this->erase(this->begin() + static_cast<std::ptrdiff_t>(at), this->end());
+            return tail;
+        }
+
+        /**
+         * @brief Drains elements from the specified range, returning a view that moves each one out.
+         *        The range is removed when the view is destroyed, even if it was only partially consumed.
+         *
+         * @param range Either a subrange of iter_mut() or an index range such as std::views::iota(a, b).
+         * @return A Drain view over the drained elements.
+         * @throws std::out_of_range if the range is out of bounds.
+         */
+        [[nodiscard]] auto drain(std::ranges::range auto range) -> Drain {
+            const auto [start, end] = detail::drain_bounds(range, this->begin());
+            if (start > end || end > this->size()) [[unlikely]] {
+                detail::throw_out_of_range("drain range out of bounds");
+            }
+            return Drain(this, start, end);
+        }
+
+        /**
+         * @brief Drains all elements, returning a view that moves each one out.
+         *
+         * @return A Drain view over the whole vector.
+         */
+        [[nodiscard]] auto drain() noexcept -> Drain {
+            return Drain(this, 0, this->size());
+        }
+
+        /**
+         * @brief Replaces the elements in `range` with the elements of `replacement`, shifting
+         *        the tail at most once. Replacement elements first overwrite the removed slots;
+         *        any surplus is inserted with insert_many(), a shortfall closes the gap.
+         *        Everything that may throw (allocation, reading or converting the replacement)
+         *        happens before the vector is modified, so it is left unchanged on exception.
+         *        A replacement whose elements cannot be assigned without throwing is first
+         *        collected into a buffer; T itself must be nothrow movable.
+         *
+         * @param range Either a subrange of iter_mut() or an index range such as std::views::iota(a, b).
+         *        An empty range such as iota(i, i) inserts at `i`.
+         * @param replacement The elements to put in place of the removed ones; must not refer to this vector.
+         * @return A Vec with the removed elements, in order.
+         * @throws std::out_of_range if the range is out of bounds.
+         */
+        template <std::ranges::range Range, std::ranges::input_range R>
+        requires std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T> &&
+                 std::constructible_from<T, std::ranges::range_reference_t<R>> &&
+                 std::assignable_from<T&, std::ranges::range_reference_t<R>>
+        auto splice(Range range, R&& replacement) -> Vec {
+            const auto [start, end] = detail::drain_bounds(range, this->begin());
+            if (start > end || end > this->size()) [[unlikely]] {
+                detail::throw_out_of_range("splice range out of bounds");
+            }
+            using Ref = std::ranges::range_reference_t<R>;
+            if constexpr ((!std::ranges::forward_range<R> && !std::ranges::sized_range<R>) ||
+                          !std::is_nothrow_assignable_v<T&, Ref> || !std::is_nothrow_constructible_v<T, Ref>) {
+                Vec incoming(this->get_allocator());
+                incoming.extend(std::forward<R>(replacement));
+                return splice(std::views::iota(start, end), std::ranges::subrange(std::make_move_iterator(incoming.begin()),
+                                                                                  std::make_move_iterator(incoming.end())));
+            } else {
+                const auto count = static_cast<size_t>(std::ranges::distance(replacement));
+                Vec removed(this->get_allocator());
+                removed.reserve_exact(end - start);
+                if (count > end - start) {
+                    reserve(count - (end - start));
+                }
+                // Nothing below allocates or throws
+                for (size_t i = start; i < end; ++i) {
+                    removed.push_back(std::move(this->data()[i]));
+                }
+
+                auto it = std::ranges::begin(replacement);
+                const auto last = std::ranges::end(replacement);
+                size_t slot = start;
+                for (; slot < end && it != last; ++slot, ++it) {
+                    this->data()[slot] = *it;
+                }
+                if (slot < end) {
+                    close_drain(slot, end);
+                } else if (it != last) {
+                    if constexpr (std::ranges::forward_range<R> && !(detail::relocatable<T> && !detail::bitwise_copyable<T>)) {
+                        insert_many(end, std::ranges::subrange(std::move(it), last));
+                    } else {
+                        // insert_many() would buffer an input range or allocate a relocation buffer;
+                        // append into the reserved capacity and rotate into place instead
+                        const size_t len = this->size();
+                        for (; it != last; ++it) {
+                            this->emplace_back(*it);
+                        }
+                        std::rotate(this->data() + end, this->data() + len, this->data() + this->size());
+                    }
+                }
+                return removed;
+            }
+        }
+
+        /**
+         * @brief Moves all elements to the back of `dest`, leaving this vector empty.
+         *        Steals the buffer when `dest` is empty and the allocators allow it, otherwise
+         *        relocates in one bulk move (memcpy for trivially copyable and trivially
+         *        relocatable T, no per-element move constructors).
+         *
+         * @param dest The vector receiving the elements.
+         */
+        void drain_into(Vec& dest) {
+            if (&dest == this) {
+                return;
+            }
+            if (dest.empty() && can_steal_from(dest)) {
+                static_cast<std::vector<T, Alloc>&>(dest).swap(*this);
+                this->clear();
+                return;
+            }
+            dest.grow_for(this->size());  // Under OXIDE_PANIC_ON_ALLOC_FAILURE this reserves, so neither path below reallocates
+            if constexpr (detail::relocatable<T> && !detail::bitwise_copyable<T> && std::is_nothrow_default_constructible_v<T>) {
+                // Value-initialized placeholders give dest its new length, then the elements and
+                // the placeholders trade places with bulk byte copies; clear() destroys the placeholders
+                const size_t count = this->size();
+                const size_t dest_len = dest.size();
+                static_cast<std::vector<T, Alloc>&>(dest).resize(dest_len + count);
+                detail::relocate_swap_ranges(this->data(), dest.data() + dest_len, count);
+            } else {
+                static_cast<std::vector<T, Alloc>&>(dest).insert(dest.end(), std::make_move_iterator(this->begin()),
+                                                                 std::make_move_iterator(this->end()));
+            }
+            this->clear();
+        }
+
+    private:
+        // Single-pass compaction state shared by retain and extract_if. Elements before
+        // `write` are kept, [write, read) are gaps, and [read, len) are not visited yet.
+        // On destruction (normal or during unwinding) the unvisited tail closes the gap.
+        struct Compactor {
+            Vec& vec;
+            size_t read = 0;
+            size_t write = 0;
+            size_t len;
+
+            explicit Compactor(Vec& v) noexcept : vec(v), len(v.size()) {}
+            Compactor(const Compactor&) = delete;
+            Compactor& operator=(const Compactor&) = delete;
+
+            void keep(T* data) {
+                if (read != write) {
+                    data[write] = std::move(data[read]);
+                }
+                ++write;
+            }
+
+            ~Compactor() {
+                if (read != write) {
+                    T* data = vec.data();
+                    std::move(data + read, data + len, data + write);
+                    vec.erase(vec.begin() + static_cast<std::ptrdiff_t>(write + len - read), vec.end());
+                }
+            }
         };
 
-        struct DrainSentinel {
-            Vec* vec_ = nullptr;
-            size_t end_ = 0;
+    public:
+        /**
+         * @brief A lazy range that moves out the elements matching a predicate,
+         *        compacting the survivors as it goes. When destroyed, unvisited
+         *        elements are kept and the gaps are closed.
+         *        It is a single-use input range, not a view: it cannot be copied or moved,
+         *        so iterate it in place, e.g. `for (auto&& x : v.extract_if(pred))`.
+         */
+        template <typename F>
+        class ExtractIf {
+        public:
+            class iterator {
+            public:
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+
+                iterator() = default;
+                explicit iterator(ExtractIf* parent) noexcept : parent_(parent) {}
+
+                T&& operator*() const {
+                    return std::move(parent_->vec_->data()[parent_->compactor_.read]);
+                }
+
+                iterator& operator++() {
+                    ++parent_->compactor_.read;  // The yielded element becomes a gap
+                    parent_->advance();
+                    return *this;
+                }
+
+                void operator++(int) { ++*this; }
+
+                friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+                    return it.done();
+                }
+
+            private:
+                [[nodiscard]] bool done() const noexcept {
+                    return !parent_->has_current_;
+                }
+
+                ExtractIf* parent_ = nullptr;
+            };
+
+            ExtractIf(Vec* vec, F pred) : vec_(vec), pred_(std::move(pred)), compactor_(*vec) {}
+
+            ExtractIf(const ExtractIf&) = delete;
+            ExtractIf& operator=(const ExtractIf&) = delete;
+            ExtractIf(ExtractIf&&) = delete;
+            ExtractIf& operator=(ExtractIf&&) = delete;
+
+            [[nodiscard]] iterator begin() {
+                if (!started_) {
+                    started_ = true;
+                    advance();
+                }
+                return iterator(this);
+            }
+
+            [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
 
-            // TODO: do not make this explicit
-            operator DrainIterator() const noexcept {
-                return DrainIterator(vec_, end_, end_);
+        private:
+            // Stops at the next matching element, moving the survivors it passes into place.
+            // The match stays unvisited until operator++ moves past it, so dropping the
+            // range before then keeps it.
+            void advance() {
+                has_current_ = false;
+                T* data = vec_->data();
+                for (; compactor_.read < compactor_.len; ++compactor_.read) {
+                    if (std::invoke(pred_, data[compactor_.read])) {
+                        has_current_ = true;
+                        return;
+                    }
+                    compactor_.keep(data);
+                }
             }
+
+            Vec* vec_;
+            F pred_;
+            Compactor compactor_;
+            bool has_current_ = false;
+            bool started_ = false;
         };
 
         /**
-         * @brief Drains elements from the specified range,
-         *        returning a subrange view for iteration and removal.
+         * @brief Lazily removes and yields the elements for which `pred` returns true.
+         *        Elements are only examined as the range is iterated; dropping the range
+         *        early keeps the rest. Each survivor is moved at most once.
          *
-         * @param range The range specifying the elements to drain.
-         * @return A subrange with DrainIterator and DrainSentinel representing the drained elements.
+         * @param pred A predicate taking `T&`.
+         * @return An ExtractIf range yielding the extracted elements as rvalues.
          */
-        [[nodiscard]] auto drain(std::ranges::range auto range) -> std::ranges::subrange<DrainIterator, DrainSentinel> {
-            auto [start, end] = [&]() -> std::pair<size_t, size_t> {
-                if constexpr (std::is_same_v<decltype(range), std::ranges::subrange<typename std::vector<T>::iterator>>) {
-                    return {std::distance(this->begin(), range.begin()), std::distance(this->begin(), range.end())};
-                } else {
-                    return {range.begin(), range.end()};
+        template <typename F>
+        requires std::predicate<F&, T&>
+        [[nodiscard]] auto extract_if(F pred) -> ExtractIf<F> {
+            return ExtractIf<F>(this, std::move(pred));
+        }
+
+    private:
+        friend Drain;
+
+        // Removes [start, end) after a drain, shifting the tail down once
+        void close_drain(const size_t start, const size_t end) noexcept {
+            if (start == end) {
+                return;
+            }
+            if constexpr (detail::bitwise_copyable<T>) {
+                T* data = this->data();
+                std::memmove(data + start, data + end, (this->size() - end) * sizeof(T));
+                this->erase(this->end() - static_cast<std::ptrdiff_t>(end - start), this->end());
+            } else if constexpr (detail::relocatable<T> && std::is_nothrow_default_constructible_v<T>) {
+                // Destroy the drained slots and relocate the tail over them. The last slots then
+                // hold stale copies of relocated objects, so they are reset before the vector
+                // shrinks and destroys them.
+                T* data = this->data();
+                const size_t len = this->size();
+                std::destroy(data + start, data + end);
+                std::memmove(static_cast<void*>(data + start), static_cast<const void*>(data + end), (len - end) * sizeof(T));
+                std::uninitialized_value_construct(data + len - (end - start), data + len);
+                this->erase(this->end() - static_cast<std::ptrdiff_t>(end - start), this->end());
+            } else {
+                this->erase(this->begin() + static_cast<std::ptrdiff_t>(start), this->begin() + static_cast<std::ptrdiff_t>(end));
+            }
+        }
+
+        // insert_many() for relocatable, non-trivially-copyable T: the new elements are built at
+        // the back, then the tail and the new block swap places with three bulk byte copies
+        template <typename R>
+        void insert_relocating(const size_t index, const size_t count, R& range) {
+            const size_t len = this->size();
+            const auto buffer = std::make_unique_for_overwrite<std::byte[]>(count * sizeof(T));
+#if !defined(OXIDE_NO_EXCEPTIONS)
+            try {
+#endif
+                for (auto&& value : range) {
+                    this->emplace_back(std::forward<decltype(value)>(value));  // Capacity is reserved
+                }
+#if !defined(OXIDE_NO_EXCEPTIONS)
+            } catch (...) {
+                this->erase(this->begin() + static_cast<std::ptrdiff_t>(len), this->end());
+                throw;
+            }
+#endif
+            T* data = this->data();
+            std::memcpy(buffer.get(), static_cast<const void*>(data + len), count * sizeof(T));
+            std::memmove(static_cast<void*>(data + index + count), static_cast<const void*>(data + index), (len - index) * sizeof(T));
+            std::memcpy(static_cast<void*>(data + index), buffer.get(), count * sizeof(T));
+        }
+
+        // Shared by chunks() and chunks_exact(): exact views drop the short tail into remainder()
+        template <typename U>
+        [[nodiscard]] static auto make_chunks(std::span<U> slice, const size_t size, const bool exact) -> Chunks<U> {
+            if (size == 0) [[unlikely]] panic("chunk size must be non-zero");
+            const size_t count = exact ? slice.size() / size : (slice.size() + size - 1) / size;
+            return Chunks<U>(slice, size, size, count);
+        }
+
+        template <bool Max>
+        [[nodiscard]] auto extremum() const -> Option<T> {
+            if (this->empty()) {
+                return Option<T>();
+            }
+            if constexpr (simd::element<T>) {
+                const T result = simd::extremum<Max>(as_slice());
+                // The identity (an infinity for floats) comes back when every element was NaN
+                if constexpr (std::is_floating_point_v<T>) {
+                    if (result == simd::detail::extremum_identity<Max, T>() && !contains(result)) {
+                        return Option<T>();
+                    }
+                }
+                return Option<T>(result);
+            } else {
+                return Option<T>(Max ? *std::ranges::max_element(as_slice()) : *std::ranges::min_element(as_slice()));
+            }
+        }
+
+        // Buffers can only be swapped when the two allocators can free each other's memory
+        [[nodiscard]] bool can_steal_from(const Vec& other) const noexcept {
+            using traits = std::allocator_traits<Alloc>;
+            if constexpr (traits::is_always_equal::value || traits::propagate_on_container_swap::value) {
+                return true;
+            } else {
+                return this->get_allocator() == other.get_allocator();
+            }
+        }
+
+        // Radix sorts the elements themselves, for small trivially copyable T
+        template <typename BitsFn>
+        void radix_sort_elements(BitsFn bits) {
+            std::vector<T> scratch(this->data(), this->data() + this->size());
+            detail::radix_sort(this->data(), this->size(), scratch.data(), bits);
+        }
+
+        // Radix sorts (key bits, index) pairs and then moves every element once into place
+        template <typename F>
+        void radix_sort_by_key(F& key) {
+            using U = decltype(detail::radix_bits(std::invoke(key, std::declval<const T&>())));
+            struct Keyed {
+                U bits;
+                size_t index;
+            };
+            const size_t len = this->size();
+            std::vector<Keyed> keyed(len);
+            for (size_t i = 0; i < len; ++i) {
+                keyed[i] = Keyed{detail::radix_bits(std::invoke(key, this->data()[i])), i};
+            }
+            std::vector<Keyed> scratch(len);
+            detail::radix_sort(keyed.data(), len, scratch.data(), [](const Keyed& k) { return k.bits; });
+            std::vector<size_t> order;
+            order.reserve(len);
+            for (const auto& k : keyed) {
+                order.push_back(k.index);
+            }
+            apply_order(order);
+        }
+
+        // Rebuilds the vector as [data[order[0]], data[order[1]], ...], moving each element once
+        void apply_order(const std::vector<size_t>& order) {
+            Vec sorted(this->get_allocator());
+            sorted.reserve_exact(order.size());
+            for (const size_t index : order) {
+                sorted.push_back(std::move(this->data()[index]));
+            }
+            static_cast<std::vector<T, Alloc>&>(*this).swap(sorted);
+        }
+
+        // Applies the growth policy before an operation that needs `additional` more slots
+        void grow_for(const size_t additional) {
+#if defined(OXIDE_PANIC_ON_ALLOC_FAILURE)
+            if (const auto grown = try_grow_for(additional, true); !grown) [[unlikely]] {
+                detail::alloc_failure(grown.error());
+            }
+#else
+            if constexpr (growth::custom<Growth>) {
+                const size_t required = this->size() + additional;
+                if (required > capacity()) {
+                    static_cast<std::vector<T, Alloc>&>(*this).reserve(Growth::next_capacity(capacity(), required, sizeof(T)));
+                }
+            }
+#endif
+        }
+
+        // Makes room for `additional` more elements: policy-rounded for custom growth policies,
+        // otherwise exact, or doubling when `amortized` (matching std::vector's own growth)
+        auto try_grow_for(const size_t additional, const bool amortized) -> Result<void, AllocError> {
+            const size_t len = this->size();
+            if (additional <= capacity() - len) {
+                return {};
+            }
+            if (additional > this->max_size() - len) {
+                return std::unexpected(AllocError{AllocError::Kind::CapacityOverflow, 0});
+            }
+            const size_t required = len + additional;
+            size_t target = required;
+            if constexpr (growth::custom<Growth>) {
+                target = Growth::next_capacity(capacity(), required, sizeof(T));
+            } else if (amortized) {
+                target = std::max(required, std::min(2 * capacity(), this->max_size()));
+            }
+            return try_grow_to(target);
+        }
+
+        // Reallocates to hold `new_cap` elements, reporting allocation failure instead of throwing
+        auto try_grow_to(const size_t new_cap) -> Result<void, AllocError> {
+            if (new_cap <= capacity()) {
+                return {};
+            }
+            if (new_cap > this->max_size()) {
+                return std::unexpected(AllocError{AllocError::Kind::CapacityOverflow, 0});
+            }
+#if !defined(OXIDE_NO_EXCEPTIONS)
+            try {
+                static_cast<std::vector<T, Alloc>&>(*this).reserve(new_cap);
+            } catch (const std::bad_alloc&) {
+                return std::unexpected(AllocError{AllocError::Kind::AllocFailed, new_cap * sizeof(T)});
+            }
+#else
+            // std::vector cannot report a failed allocation without exceptions: std::allocator
+            // terminates inside reserve(), so only CapacityOverflow is returned in this mode
+            static_cast<std::vector<T, Alloc>&>(*this).reserve(new_cap);
+#endif
+            return {};
+        }
+    };
+
+    /**
+     * @brief A parallel iterator over a contiguous slice, returned by Vec::par_iter() and
+     *        Vec::par_iter_mut(). The slice is split adaptively on a work-stealing ThreadPool,
+     *        so uneven per-element work is balanced automatically. Every callable is invoked
+     *        concurrently from several threads and must be safe to share.
+     *
+     * @tparam T The element type, const-qualified for par_iter().
+     * @tparam Map The projection applied to each element, composed by map().
+     */
+    template <typename T, typename Map>
+    class ParIter {
+    public:
+        using item_type = std::invoke_result_t<const Map&, T&>;
+        using value_type = std::remove_cvref_t<item_type>;
+
+        explicit ParIter(std::span<T> slice, Map map = {}, ThreadPool* pool = nullptr, const size_t min_len = 1) noexcept
+            : m_slice(slice), m_map(std::move(map)), m_pool(pool), m_min_len(min_len) {}
+
+        /**
+         * @brief Runs on `pool` instead of ThreadPool::global().
+         */
+        [[nodiscard]] auto with_pool(ThreadPool& pool) const -> ParIter {
+            return ParIter(m_slice, m_map, &pool, m_min_len);
+        }
+
+        /**
+         * @brief Never splits the slice into pieces shorter than `min_len` elements. Useful when
+         *        the per-element work is tiny and forking would dominate.
+         */
+        [[nodiscard]] auto with_min_len(const size_t min_len) const -> ParIter {
+            return ParIter(m_slice, m_map, m_pool, min_len);
+        }
+
+        /**
+         * @brief Lazily applies `f` to every item.
+         *
+         * @param f The projection, called as f(item).
+         * @return A parallel iterator over the projected items.
+         */
+        template <typename F>
+        [[nodiscard]] auto map(F f) const {
+            auto composed = [inner = m_map, f = std::move(f)](T& element) -> decltype(auto) {
+                return std::invoke(f, std::invoke(inner, element));
+            };
+            return ParIter<T, decltype(composed)>(m_slice, std::move(composed), m_pool, m_min_len);
+        }
+
+        /**
+         * @brief Calls `f` on every item, in no particular order.
+         *
+         * @param f The function to call, called as f(item).
+         */
+        template <typename F>
+        void for_each(const F& f) const {
+            detail::par_for(pool(), m_slice.size(), m_min_len, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    std::invoke(f, std::invoke(m_map, m_slice[i]));
+                }
+            });
+        }
+
+        /**
+         * @brief Folds all items with `op`. Each piece starts its fold from a copy of `identity`,
+         *        so `identity` must be neutral for `op` (e.g. 0 for +), and `op` must be associative.
+         *        Pieces are combined in slice order, so `op` need not be commutative.
+         *
+         * @param identity The neutral element.
+         * @param op The associative operation, called as op(accumulator, item).
+         * @return The folded value, or `identity` for an empty slice.
+         */
+        template <typename Op>
+        [[nodiscard]] auto reduce(value_type identity, const Op& op) const -> value_type {
+            return detail::par_reduce(pool(), m_slice.size(), m_min_len, [&](const size_t begin, const size_t end) {
+                value_type acc = identity;
+                for (size_t i = begin; i < end; ++i) {
+                    acc = std::invoke(op, std::move(acc), std::invoke(m_map, m_slice[i]));
+                }
+                return acc;
+            }, [&](value_type left, value_type right) {
+                return std::invoke(op, std::move(left), std::move(right));
+            });
+        }
+
+        /**
+         * @brief Returns true if `pred` holds for any item. Stops all threads soon after a match.
+         *
+         * @param pred The predicate, called as pred(item).
+         */
+        template <typename P>
+        [[nodiscard]] bool any(const P& pred) const {
+            std::atomic<bool> found{false};
+            detail::par_for(pool(), m_slice.size(), m_min_len, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end && !found.load(std::memory_order_relaxed); ++i) {
+                    if (std::invoke(pred, std::invoke(m_map, m_slice[i]))) {
+                        found.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }, &found);
+            return found.load();
+        }
+
+        /**
+         * @brief Returns true if `pred` holds for every item (vacuously true when empty).
+         *        Stops all threads soon after a counterexample.
+         *
+         * @param pred The predicate, called as pred(item).
+         */
+        template <typename P>
+        [[nodiscard]] bool all(const P& pred) const {
+            return !any([&](auto&& item) { return !std::invoke(pred, std::forward<decltype(item)>(item)); });
+        }
+
+        /**
+         * @brief Returns some element matching `pred`, not necessarily the first one.
+         *        Stops all threads soon after a match.
+         *
+         * @param pred The predicate, called as pred(element).
+         * @return Some(element) if one matches, None otherwise.
+         */
+        template <typename P>
+        [[nodiscard]] auto find_any(const P& pred) const -> Option<T&> requires std::same_as<Map, std::identity> {
+            std::atomic<bool> done{false};
+            std::atomic<T*> found{nullptr};
+            detail::par_for(pool(), m_slice.size(), m_min_len, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end && !done.load(std::memory_order_relaxed); ++i) {
+                    if (std::invoke(pred, m_slice[i])) {
+                        found.store(&m_slice[i], std::memory_order_relaxed);
+                        done.store(true, std::memory_order_relaxed);
+                    }
                 }
-            }();
-            if (start > end || end > this->size()) {
-                throw std::out_of_range("drain range out of bounds");
+            }, &done);
+            if (T* match = found.load()) {
+                return Option<T&>(*match);
             }
-            return std::ranges::subrange<DrainIterator, DrainSentinel>(DrainIterator(this, start, end), DrainSentinel{this, end});
+            return Option<T&>();
+        }
+
+        /**
+         * @brief Collects the items into a Vec, preserving slice order.
+         *
+         * @return A Vec with one value per element.
+         */
+        [[nodiscard]] auto collect() const -> Vec<value_type> {
+            const size_t n = m_slice.size();
+            if constexpr (std::default_initializable<value_type> && std::is_move_assignable_v<value_type> &&
+                          !std::same_as<value_type, bool>) {
+                // Every index is written by exactly one piece, straight into its final slot. Not for
+                // bool: std::vector<bool> packs neighbouring slots into one word, so writes would race.
+                std::vector<value_type> out(n);
+                detail::par_for(pool(), n, m_min_len, [&](const size_t begin, const size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        out[i] = std::invoke(m_map, m_slice[i]);
+                    }
+                });
+                return Vec<value_type>(std::move(out));
+            } else {
+                // Pieces fill private buffers that are spliced in order, then moved out once
+                using Pieces = std::list<std::vector<value_type>>;
+                Pieces pieces = detail::par_reduce(pool(), n, m_min_len, [&](const size_t begin, const size_t end) {
+                    Pieces piece(1);
+                    piece.front().reserve(end - begin);
+                    for (size_t i = begin; i < end; ++i) {
+                        piece.front().push_back(std::invoke(m_map, m_slice[i]));
+                    }
+                    return piece;
+                }, [](Pieces left, Pieces right) {
+                    left.splice(left.end(), right);
+                    return left;
+                });
+                Vec<value_type> out;
+                out.reserve(n);
+                for (auto& piece : pieces) {
+                    for (auto&& value : piece) {
+                        out.push(std::move(value));
+                    }
+                }
+                return out;
+            }
+        }
+
+    private:
+        std::span<T> m_slice;
+        Map m_map;
+        ThreadPool* m_pool;
+        size_t m_min_len;
+
+        [[nodiscard]] ThreadPool& pool() const {
+            return m_pool ? *m_pool : ThreadPool::global();
         }
     };
-    
+
+    // Small vector type, stores up to N elements inline before spilling to the heap
+    template <typename T, size_t N>
+    class SmallVec {
+        static_assert(N > 0, "SmallVec requires an inline capacity of at least one element");
+
+    private:
+        alignas(T) unsigned char m_inline[sizeof(T) * N];
+        T* m_data;
+        size_t m_len = 0;
+        size_t m_cap = N;
+
+        T* inline_ptr() noexcept { return reinterpret_cast<T*>(m_inline); }
+
+        void grow(const size_t min_cap) {
+            std::allocator<T> alloc;
+            const size_t max_cap = std::allocator_traits<std::allocator<T>>::max_size(alloc);
+            if (min_cap > max_cap) [[unlikely]] {
+#if defined(OXIDE_NO_EXCEPTIONS)
+                panic("SmallVec capacity overflow");
+#else
+                throw std::length_error("SmallVec capacity overflow");
+#endif
+            }
+            const size_t new_cap = std::max(min_cap, m_cap > max_cap / 2 ? max_cap : m_cap * 2);
+            T* fresh = alloc.allocate(new_cap);
+            // Frees the new buffer if moving or copying into it throws; the uninitialized_*
+            // algorithms have already destroyed the elements they constructed by then
+            struct Guard {
+                std::allocator<T>& alloc;
+                T* fresh;
+                size_t cap;
+                ~Guard() { if (fresh) alloc.deallocate(fresh, cap); }
+            } guard{alloc, fresh, new_cap};
+            if constexpr (detail::relocatable<T>) {
+                detail::relocate_n(m_data, m_len, fresh);  // The old objects end without destructors
+            } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(m_data, m_data + m_len, fresh);
+                std::destroy(m_data, m_data + m_len);
+            } else {
+                std::uninitialized_copy(m_data, m_data + m_len, fresh);
+                std::destroy(m_data, m_data + m_len);
+            }
+            guard.fresh = nullptr;
+            release();
+            m_data = fresh;
+            m_cap = new_cap;
+        }
+
+        void release() noexcept {
+            if (spilled()) {
+                std::allocator<T>().deallocate(m_data, m_cap);
+            }
+            m_data = inline_ptr();
+            m_cap = N;
+        }
+
+        friend detail::Drain<SmallVec, T>;
+
+        // Removes [start, end), shifting the tail down once
+        void close_drain(const size_t start, const size_t end) noexcept {
+            if constexpr (detail::relocatable<T>) {
+                std::destroy(m_data + start, m_data + end);
+                std::memmove(static_cast<void*>(m_data + start), static_cast<const void*>(m_data + end), (m_len - end) * sizeof(T));
+            } else {
+                std::move(m_data + end, m_data + m_len, m_data + start);
+                std::destroy(m_data + m_len - (end - start), m_data + m_len);
+            }
+            m_len -= end - start;
+        }
+
+        void steal(SmallVec&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (other.spilled()) {
+                m_data = std::exchange(other.m_data, other.inline_ptr());
+                m_cap = std::exchange(other.m_cap, N);
+                m_len = std::exchange(other.m_len, 0);
+            } else if constexpr (detail::relocatable<T>) {
+                detail::relocate_n(other.m_data, other.m_len, m_data);
+                m_len = std::exchange(other.m_len, 0);
+            } else {
+                std::uninitialized_move(other.m_data, other.m_data + other.m_len, m_data);
+                m_len = other.m_len;
+                other.clear();
+            }
+        }
+
+    public:
+        using value_type = T;
+
+        SmallVec() noexcept : m_data(inline_ptr()) {}
+
+        SmallVec(std::initializer_list<T> init) : SmallVec(init.begin(), init.end()) {}
+
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        SmallVec(It first, S last) : SmallVec() {
+            if constexpr (std::sized_sentinel_for<S, It>) {
+                reserve(static_cast<size_t>(last - first));
+            }
+            for (; first != last; ++first) {
+                push(*first);
+            }
+        }
+
+        SmallVec(const SmallVec& other) : SmallVec(other.m_data, other.m_data + other.m_len) {}
+
+        SmallVec(SmallVec&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallVec() {
+            steal(std::move(other));
+        }
+
+        SmallVec& operator=(const SmallVec& other) {
+            if (this != &other) {
+                SmallVec copy(other);
+                clear();
+                release();
+                steal(std::move(copy));
+            }
+            return *this;
+        }
+
+        SmallVec& operator=(SmallVec&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                clear();
+                release();
+                steal(std::move(other));
+            }
+            return *this;
+        }
+
+        ~SmallVec() {
+            clear();
+            release();
+        }
+
+        /**
+         * @brief Returns a const pointer to the vector's buffer.
+         *
+         * @return A const pointer to the first element (inline or heap storage).
+         */
+        [[nodiscard]] const T* as_ptr() const noexcept {
+            return m_data;
+        }
+
+        /**
+         * @brief Returns a mutable pointer to the vector's buffer.
+         *
+         * @return A mutable pointer to the first element (inline or heap storage).
+         */
+        [[nodiscard]] T* as_mut_ptr() noexcept {
+            return m_data;
+        }
+
+        /**
+         * @brief Checks whether the elements have moved from inline storage to the heap.
+         *
+         * @return true if the vector has outgrown its inline capacity, false otherwise.
+         */
+        [[nodiscard]] bool spilled() const noexcept {
+            return m_cap > N;
+        }
+
+        /**
+         * @brief Removes all elements from the vector, keeping the current storage.
+         */
+        void clear() noexcept {
+            std::destroy(m_data, m_data + m_len);
+            m_len = 0;
+        }
+
+        /**
+         * @brief Shortens the vector to the specified length, removing elements from the end.
+         *        If len >= current length, does nothing.
+         *
+         * @param len The new length of the vector.
+         */
+        void truncate(size_t len) noexcept {
+            if (len < m_len) {
+                std::destroy(m_data + len, m_data + m_len);
+                m_len = len;
+            }
+        }
+
+        /**
+         * @brief Returns a const slice of the vector's elements.
+         *
+         * @return A std::span<const T> over the vector's elements.
+         */
+        [[nodiscard]] std::span<const T> as_slice() const noexcept {
+            return std::span<const T>(m_data, m_len);
+        }
+
+        /**
+         * @brief Returns a mutable slice of the vector's elements.
+         *
+         * @return A std::span<T> over the vector's elements.
+         */
+        [[nodiscard]] std::span<T> as_mut_slice() noexcept {
+            return std::span<T>(m_data, m_len);
+        }
+
+        /**
+         * @brief Accesses the element at the specified index.
+         *
+         * @param index The index of the element to access (must be within bounds).
+         * @return A reference to the element at the given index.
+         * @throws std::out_of_range if the index is out of bounds.
+         */
+        [[nodiscard]] auto operator[](const size_t index) -> T& {
+            if (index >= m_len) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
+            }
+            return m_data[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index (const version).
+         *
+         * @param index The index of the element to access (must be within bounds).
+         * @return A const reference to the element at the given index.
+         * @throws std::out_of_range if the index is out of bounds.
+         */
+        [[nodiscard]] auto operator[](const size_t index) const -> const T& {
+            if (index >= m_len) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
+            }
+            return m_data[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index without bounds checking.
+         *
+         * @param index The index of the element to access (must be less than len()).
+         * @return A reference to the element at the given index.
+         * @warning Passing an out-of-bounds index is undefined behavior.
+         */
+        [[nodiscard]] auto get_unchecked(const size_t index) noexcept -> T& {
+            return m_data[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index without bounds checking (const version).
+         *
+         * @param index The index of the element to access (must be less than len()).
+         * @return A const reference to the element at the given index.
+         * @warning Passing an out-of-bounds index is undefined behavior.
+         */
+        [[nodiscard]] auto get_unchecked(const size_t index) const noexcept -> const T& {
+            return m_data[index];
+        }
+
+        /**
+         * @brief Returns the number of elements in the vector.
+         *
+         * @return The size of the vector as a size_t.
+         */
+        [[nodiscard]] constexpr auto len() const noexcept -> size_t {
+            return m_len;
+        }
+
+        /**
+         * @brief Removes and returns the last element from the vector if it exists.
+         *
+         * @return An Option containing the moved last element if the vector is not empty,
+         *         otherwise None.
+         */
+        [[nodiscard]] auto pop() -> Option<T> {
+            if (m_len == 0) {
+                return None<T>();
+            }
+            T value = std::move(m_data[m_len - 1]);
+            std::destroy_at(m_data + --m_len);
+            return Some(std::move(value));
+        }
+
+        /**
+         * @brief Retrieves a reference to the element at the specified index if it exists.
+         *
+         * @param index The index of the element to retrieve.
+         * @return An Option containing a reference to the element if the index is within bounds,
+         *         otherwise None.
+         */
+        [[nodiscard]] auto get(size_t index) noexcept -> Option<T&> {
+            if (index < m_len) {
+                return Option<T&>(m_data[index]);
+            }
+            return Option<T&>(_none);
+        }
+
+        /**
+         * @brief Retrieves a const reference to the element at the specified index if it exists.
+         *
+         * @param index The index of the element to retrieve.
+         * @return An Option containing a const reference to the element if the index is within bounds,
+         *         otherwise None.
+         */
+        [[nodiscard]] auto get(size_t index) const noexcept -> Option<const T&> {
+            if (index < m_len) {
+                return Option<const T&>(m_data[index]);
+            }
+            return Option<const T&>(_none);
+        }
+
+        /**
+         * @brief Appends an element to the back of the vector, spilling to the heap
+         *        when the inline capacity is exhausted.
+         *
+         * @param value The value to append (moved into the vector).
+         */
+        void push(T value) {
+            if (m_len == m_cap) {
+                grow(m_len + 1);
+            }
+            std::construct_at(m_data + m_len, std::move(value));
+            ++m_len;
+        }
+
+        /**
+         * @brief Inserts an element at the specified position in the vector.
+         *        Throws if the index is greater than the current length.
+         *
+         * @param index The position at which to insert the element (0 <= index <= len()).
+         * @param value The value to insert (moved into the vector).
+         * @throws std::out_of_range if index > len().
+         */
+        void insert(size_t index, T value) {
+            if (index > m_len) {
+                detail::throw_out_of_range("insert index out of bounds");
+            }
+            push(std::move(value));
+            if constexpr (detail::relocatable<T>) {
+                detail::relocate_rotate_right(m_data + index, m_len - 1 - index);
+            } else {
+                std::rotate(m_data + index, m_data + m_len - 1, m_data + m_len);
+            }
+        }
+
+        /**
+         * @brief Removes the element at the specified position and returns it.
+         *        It shifts subsequent elements down and throws if the index is out of bounds.
+         *
+         * @param index The index of the element to remove (0 <= index < len()).
+         * @return The removed element (moved out).
+         * @throws std::out_of_range if index >= len().
+         */
+        [[nodiscard]] auto remove(size_t index) -> T {
+            if (index >= m_len) {
+                detail::throw_out_of_range("remove index out of bounds");
+            }
+            T value = std::move(m_data[index]);
+            close_drain(index, index + 1);
+            return value;
+        }
+
+        /**
+         * @brief Checks if the vector contains no elements.
+         *
+         * @return true if the vector is empty, false otherwise.
+         */
+        [[nodiscard]] bool is_empty() const noexcept {
+            return m_len == 0;
+        }
+
+        /**
+         * @brief Returns the total number of elements the vector can hold without reallocating.
+         *
+         * @return The capacity of the vector, at least N.
+         */
+        [[nodiscard]] size_t capacity() const noexcept {
+            return m_cap;
+        }
+
+        /**
+         * @brief Reserves capacity for at least `additional` more elements.
+         *        Spills to the heap if the result no longer fits inline.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         */
+        void reserve(size_t additional) {
+            if (additional > m_cap - m_len) {
+                grow(additional > std::numeric_limits<size_t>::max() - m_len ? std::numeric_limits<size_t>::max() : m_len + additional);
+            }
+        }
+
+        /**
+         * @brief Returns a const range over the elements (for immutable iteration).
+         *
+         * @return A subrange representing the const view of the vector.
+         */
+        [[nodiscard]] auto iter() const noexcept -> std::ranges::subrange<const T*> {
+            return std::ranges::subrange<const T*>(m_data, m_data + m_len);
+        }
+
+        /**
+         * @brief Returns a mutable range over the elements (for mutable iteration).
+         *
+         * @return A subrange representing the mutable view of the vector.
+         */
+        [[nodiscard]] auto iter_mut() noexcept -> std::ranges::subrange<T*> {
+            return std::ranges::subrange<T*>(m_data, m_data + m_len);
+        }
+
+        /**
+         * @brief A view that moves drained elements out and removes them from the vector when destroyed.
+         */
+        using Drain = detail::Drain<SmallVec, T>;
+
+        /**
+         * @brief Drains elements from the specified range, returning a view that moves each one out.
+         *        The range is removed when the view is destroyed, even if it was only partially consumed.
+         *
+         * @param range Either a subrange of iter_mut() or an index range such as std::views::iota(a, b).
+         * @return A Drain view over the drained elements.
+         * @throws std::out_of_range if the range is out of bounds.
+         */
+        [[nodiscard]] auto drain(std::ranges::range auto range) -> Drain {
+            const auto [start, end] = detail::drain_bounds(range, m_data);
+            if (start > end || end > m_len) [[unlikely]] {
+                detail::throw_out_of_range("drain range out of bounds");
+            }
+            return Drain(this, start, end);
+        }
+
+        /**
+         * @brief Drains all elements, returning a view that moves each one out.
+         *
+         * @return A Drain view over the whole vector.
+         */
+        [[nodiscard]] auto drain() noexcept -> Drain {
+            return Drain(this, 0, m_len);
+        }
+    };
+
+    /**
+     * @brief A read-only search index over sorted data, stored in Eytzinger (BFS) order.
+     *        The first levels of the implicit tree share a few cache lines, and the search
+     *        prefetches the descendants several levels ahead without branching on the comparison,
+     *        so lookups stay fast once the data no longer fits in cache.
+     *        Costs a copy of the elements plus one index per element.
+     */
+    template <typename T>
+    requires std::totally_ordered<T> && std::copy_constructible<T>
+    class EytzingerIndex {
+    private:
+        Vec<T> m_tree;        // 1-based BFS layout, slot 0 is an unused placeholder
+        Vec<size_t> m_rank;   // Position of each tree slot in the sorted input
+
+        static constexpr size_t block = std::max<size_t>(1, 64 / sizeof(T));
+
+        void build(std::span<const T> sorted, size_t& next, const size_t k) {
+            if (k <= sorted.size()) {
+                build(sorted, next, 2 * k);
+                m_tree.get_unchecked(k) = sorted[next];
+                m_rank.get_unchecked(k) = next++;
+                build(sorted, next, 2 * k + 1);
+            }
+        }
+
+    public:
+        /**
+         * @brief Builds the index from sorted elements.
+         *
+         * @param sorted Elements in ascending order, e.g. `vec.as_slice()` after `vec.sort_unstable()`.
+         */
+        explicit EytzingerIndex(std::span<const T> sorted) {
+            if (sorted.empty()) {
+                return;
+            }
+            m_tree = Vec<T>(sorted.size() + 1, sorted.front());
+            m_rank = Vec<size_t>(sorted.size() + 1, 0);
+            size_t next = 0;
+            build(sorted, next, 1);
+        }
+
+        /**
+         * @brief Returns the number of indexed elements.
+         *
+         * @return The number of elements in the sorted input.
+         */
+        [[nodiscard]] auto len() const noexcept -> size_t {
+            return m_tree.is_empty() ? 0 : m_tree.len() - 1;
+        }
+
+        /**
+         * @brief Finds `value` in the sorted input.
+         *
+         * @param value The value to look for.
+         * @return Ok with the sorted position of the first element equal to `value`,
+         *         or Err with the position where it could be inserted to keep the order.
+         */
+        [[nodiscard]] auto search(const T& value) const -> Result<size_t, size_t> {
+            const size_t n = len();
+            const T* tree = m_tree.as_ptr();
+            size_t k = 1;
+            while (k <= n) {
+                OXIDE_PREFETCH(tree + std::min(k * block, n));
+                k = 2 * k + static_cast<size_t>(tree[k] < value);
+            }
+            k >>= std::countr_one(k) + 1;  // Undo the trailing right turns to reach the lower bound
+            if (k == 0) {
+                return std::unexpected(n);
+            }
+            const size_t rank = m_rank.get_unchecked(k);
+            if (value < tree[k]) {
+                return std::unexpected(rank);
+            }
+            return rank;
+        }
+
+        /**
+         * @brief Checks whether `value` is present.
+         *
+         * @param value The value to look for.
+         * @return true if an element equal to `value` was indexed.
+         */
+        [[nodiscard]] bool contains(const T& value) const {
+            return search(value).has_value();
+        }
+    };
+
+    namespace pmr {
+        /**
+         * @brief A Vec whose storage comes from a std::pmr::memory_resource,
+         *        e.g. a std::pmr::monotonic_buffer_resource arena released in one reset.
+         */
+        template <typename T, typename Growth = growth::Std>
+        using Vec = oxide::Vec<T, std::pmr::polymorphic_allocator<T>, Growth>;
+    }
+
+    /**
+     * @brief A Vec for multi-megabyte buffers: huge-page aligned, madvise(MADV_HUGEPAGE)-backed
+     *        storage that grows by 1.5x in whole huge pages. The first push already
+     *        reserves a full huge page (2 MiB), so use it only for buffers expected to get that big.
+     */
+    template <typename T>
+    using HugePageVec = Vec<T, HugePageAllocator<T>, growth::PageGranular<huge_page_size>>;
+
     /**
      * @brief Finds the first element in the given range that satisfies the predicate.
      *
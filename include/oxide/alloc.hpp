@@ -0,0 +1,236 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_ALLOC_HPP
+#define OXIDE_ALLOC_HPP
+
+#include <cstddef>     // For std::size_t
+#include <algorithm>   // For std::max
+#include <new>         // For std::align_val_t, std::bad_array_new_length
+#include <limits>      // For std::numeric_limits
+#include <concepts>    // For std::convertible_to
+#include <memory>      // For std::allocator, std::allocator_traits
+#include <type_traits> // For std::false_type, std::true_type
+#include <utility>     // For std::forward
+
+#include "config.hpp"
+#include "output.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>  // For madvise, MADV_HUGEPAGE
+#endif
+
+namespace oxide {
+    /// Size of a regular virtual memory page
+    inline constexpr std::size_t page_size = 4096;
+
+    /// Size of a transparent huge page on x86-64 and most aarch64 Linux configurations
+    inline constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+/// ============================================================================
+/// Growth policies, decide the capacity a Vec grows to when it runs out of room
+/// ============================================================================
+    namespace growth {
+        namespace detail {
+            constexpr std::size_t round_up(const std::size_t value, const std::size_t multiple) noexcept {
+                return (value + multiple - 1) / multiple * multiple;
+            }
+        }
+
+        /**
+         * @brief Leaves growth to the standard library (typically doubling).
+         */
+        struct Std {};
+
+        /**
+         * @brief Grows the capacity by half of its current value (1.5x),
+         *        trading a few more reallocations for a lower memory peak.
+         */
+        struct Factor1_5 {
+            static constexpr std::size_t next_capacity(const std::size_t capacity, const std::size_t required,
+                                                       std::size_t /*element_size*/) noexcept {
+                return std::max(required, capacity + capacity / 2);
+            }
+        };
+
+        /**
+         * @brief Grows the capacity in fixed steps of `Increment` elements.
+         *
+         * @tparam Increment The number of elements added per growth step.
+         */
+        template <std::size_t Increment>
+        struct Fixed {
+            static_assert(Increment > 0, "growth::Fixed requires a non-zero increment");
+
+            static constexpr std::size_t next_capacity(const std::size_t capacity, const std::size_t required,
+                                                       std::size_t /*element_size*/) noexcept {
+                return capacity + detail::round_up(required - capacity, Increment);
+            }
+        };
+
+        /**
+         * @brief Grows by 1.5x and rounds the buffer size up to a whole number of pages,
+         *        so no partially used page is ever allocated.
+         *
+         * @tparam Page The page size in bytes (use oxide::huge_page_size with HugePageAllocator).
+         */
+        template <std::size_t Page = page_size>
+        struct PageGranular {
+            static constexpr std::size_t next_capacity(const std::size_t capacity, const std::size_t required,
+                                                       const std::size_t element_size) noexcept {
+                const std::size_t wanted = Factor1_5::next_capacity(capacity, required, element_size);
+                // Beyond this the byte size or its rounding would wrap; the caller rejects it against max_size()
+                if (wanted > (std::numeric_limits<std::size_t>::max() - (Page - 1)) / element_size) {
+                    return wanted;
+                }
+                return detail::round_up(wanted * element_size, Page) / element_size;
+            }
+        };
+
+        /**
+         * @brief Satisfied by policies that compute the next capacity themselves.
+         */
+        template <typename G>
+        concept custom = requires(std::size_t n) {
+            { G::next_capacity(n, n, n) } -> std::convertible_to<std::size_t>;
+        };
+    }
+
+/// ============================================================================
+/// Allocator that backs large buffers with transparent huge pages
+/// ============================================================================
+    /**
+     * @brief A stateless allocator that aligns buffers of at least `huge_page_size` bytes
+     *        to huge page boundaries and, on Linux, marks them with madvise(MADV_HUGEPAGE).
+     *        Smaller buffers use the regular aligned operator new.
+     */
+    template <typename T>
+    struct HugePageAllocator {
+        using value_type = T;
+
+        constexpr HugePageAllocator() noexcept = default;
+        template <typename U>
+        constexpr HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+        [[nodiscard]] T* allocate(const std::size_t n) {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+#if defined(OXIDE_NO_EXCEPTIONS)
+                panic("allocation size overflow");
+#else
+                throw std::bad_array_new_length();
+#endif
+            }
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes < huge_page_size) {
+                return static_cast<T*>(::operator new(bytes, std::align_val_t{alignof(T)}));
+            }
+            const std::size_t rounded = growth::detail::round_up(bytes, huge_page_size);
+            void* ptr = ::operator new(rounded, std::align_val_t{huge_page_size});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            // Advisory only; the mapping still works if THP is disabled
+            ::madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+            return static_cast<T*>(ptr);
+        }
+
+        void deallocate(T* ptr, const std::size_t n) noexcept {
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes < huge_page_size) {
+                ::operator delete(ptr, bytes, std::align_val_t{alignof(T)});
+                return;
+            }
+            ::operator delete(ptr, growth::detail::round_up(bytes, huge_page_size), std::align_val_t{huge_page_size});
+        }
+
+        template <typename U>
+        friend constexpr bool operator==(const HugePageAllocator&, const HugePageAllocator<U>&) noexcept {
+            return true;
+        }
+    };
+
+/// ============================================================================
+/// Allocator adaptor that default-initializes instead of value-initializing
+/// ============================================================================
+    /**
+     * @brief Wraps `Base` so that value-less construction (as done by `resize`) default-initializes
+     *        the element, leaving trivial types untouched instead of zeroing them.
+     *        Required by Vec::set_len to expose bytes written through spare_capacity_mut().
+     */
+    template <typename T, typename Base = std::allocator<T>>
+    struct DefaultInitAllocator : Base {
+        using Base::Base;
+        using value_type = T;
+
+        constexpr DefaultInitAllocator() noexcept(noexcept(Base())) = default;
+        constexpr DefaultInitAllocator(const Base& base) noexcept : Base(base) {}
+        template <typename U, typename B>
+        constexpr DefaultInitAllocator(const DefaultInitAllocator<U, B>& other) noexcept
+            : Base(static_cast<const B&>(other)) {}
+
+        template <typename U>
+        struct rebind {
+            using other = DefaultInitAllocator<U, typename std::allocator_traits<Base>::template rebind_alloc<U>>;
+        };
+
+        template <typename U>
+        void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+            ::new (static_cast<void*>(ptr)) U;
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* ptr, Args&&... args) {
+            std::allocator_traits<Base>::construct(static_cast<Base&>(*this), ptr, std::forward<Args>(args)...);
+        }
+    };
+
+    template <typename Alloc>
+    struct is_default_init_allocator : std::false_type {};
+
+    template <typename T, typename Base>
+    struct is_default_init_allocator<DefaultInitAllocator<T, Base>> : std::true_type {};
+
+/// ============================================================================
+/// AllocError, the error of the fallible try_* growth functions
+/// ============================================================================
+    /**
+     * @brief Why a fallible allocation (Vec::try_reserve and friends) failed. Trivially copyable,
+     *        so reporting it never allocates.
+     */
+    struct AllocError {
+        enum class Kind : unsigned char {
+            CapacityOverflow,  ///< The requested capacity exceeds max_size()
+            AllocFailed,       ///< The allocator could not provide the memory
+        };
+
+        Kind kind = Kind::AllocFailed;
+        std::size_t bytes = 0;  ///< The size of the failed allocation (0 for CapacityOverflow)
+
+        [[nodiscard]] constexpr const char* what() const noexcept {
+            return kind == Kind::CapacityOverflow ? "capacity overflow" : "memory allocation failed";
+        }
+
+        friend constexpr bool operator==(const AllocError&, const AllocError&) noexcept = default;
+    };
+}  // namespace oxide
+
+#endif // OXIDE_ALLOC_HPP
@@ -0,0 +1,593 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_MMAP_VEC_HPP
+#define OXIDE_MMAP_VEC_HPP
+
+#include <cstddef>      // For std::size_t, std::byte
+#include <cstdint>      // For std::uint32_t, std::uint64_t
+#include <cstring>      // For std::memcpy, std::memcmp
+#include <cerrno>       // For errno
+#include <filesystem>   // For std::filesystem::path
+#include <functional>   // For std::less
+#include <limits>       // For std::numeric_limits
+#include <new>          // For std::launder
+#include <span>         // For std::span
+#include <type_traits>  // For std::is_trivially_copyable_v
+#include <utility>      // For std::exchange
+
+#include "../oxide.hpp"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "oxide/mmap_vec.hpp requires a POSIX system (mmap, ftruncate, msync)"
+#endif
+
+#include <fcntl.h>      // For open
+#include <sys/file.h>   // For flock
+#include <sys/mman.h>   // For mmap, mremap, msync, munmap
+#include <sys/stat.h>   // For fstat
+#include <unistd.h>     // For ftruncate, close
+
+namespace oxide {
+/// ============================================================================
+/// MmapError, the reason opening, growing or flushing an MmapVec failed
+/// ============================================================================
+    struct MmapError {
+        enum class Kind : unsigned char {
+            Io,                ///< A system call failed, see os_error
+            NotAnMmapVec,      ///< The file is not empty and does not start with an MmapVec header
+            VersionMismatch,   ///< The file format or schema version differs from the requested one
+            LayoutMismatch,    ///< The file stores elements of a different size, alignment or byte order
+            Corrupted,         ///< The stored length does not fit in the file
+            CapacityOverflow,  ///< The requested capacity does not fit in the address space
+            Locked,            ///< Another MmapVec (in this or another process) has the file open
+        };
+
+        Kind kind = Kind::Io;
+        int os_error = 0;  ///< errno of the failed call for Kind::Io, otherwise 0
+
+        [[nodiscard]] constexpr const char* what() const noexcept {
+            switch (kind) {
+                case Kind::Io: return "mmap vec I/O error";
+                case Kind::NotAnMmapVec: return "file is not an mmap vec";
+                case Kind::VersionMismatch: return "mmap vec version mismatch";
+                case Kind::LayoutMismatch: return "mmap vec element layout mismatch";
+                case Kind::Corrupted: return "mmap vec header is corrupted";
+                case Kind::CapacityOverflow: return "capacity overflow";
+                case Kind::Locked: return "mmap vec file is already open";
+            }
+            return "mmap vec error";
+        }
+
+        friend constexpr bool operator==(const MmapError&, const MmapError&) noexcept = default;
+    };
+
+    namespace detail {
+        // On-disk header, the elements start right after it at offset sizeof(MmapVecHeader)
+        struct MmapVecHeader {
+            char magic[8];
+            std::uint32_t format_version;
+            std::uint32_t schema_version;
+            std::uint32_t byte_order;
+            std::uint32_t reserved0;
+            std::uint64_t elem_size;
+            std::uint64_t elem_align;
+            std::uint64_t len;
+            std::uint64_t reserved1[2];
+        };
+        static_assert(sizeof(MmapVecHeader) == 64);
+
+        inline constexpr char mmap_vec_magic[8] = {'O', 'X', 'I', 'D', 'E', 'M', 'V', '\0'};
+        inline constexpr std::uint32_t mmap_vec_format_version = 1;
+        inline constexpr std::uint32_t mmap_vec_byte_order = 0x01020304;
+
+        [[nodiscard]] inline MmapError last_os_error() noexcept {
+            return MmapError{MmapError::Kind::Io, errno};
+        }
+
+        [[noreturn]] OXIDE_NOINLINE OXIDE_COLD inline void mmap_failure(const MmapError& error) {
+            panic(error.what());
+        }
+    }
+
+/// ============================================================================
+/// MmapVec, a file-backed Vec of trivially copyable records
+/// ============================================================================
+    /**
+     * @brief A growable array that lives in a memory-mapped file, so its contents survive restarts.
+     *
+     * The file holds a 64-byte header (magic, format and schema version, element size, alignment
+     * and byte order, length) followed by the elements. Opening an existing file maps it and checks
+     * the header, it never reads or copies the elements, so open() costs the same for any length.
+     * Growth extends the file with ftruncate and remaps it (mremap on Linux), the capacity is
+     * whatever fits in the file.
+     *
+     * Writes reach the page cache immediately and the kernel writes them back on its own schedule;
+     * call flush() when they must be on disk. Only one MmapVec may have a file open at a time:
+     * open() takes an exclusive flock on the file and fails with Kind::Locked if it is held.
+     * The lock is advisory, so it does not stop other programs from writing the file.
+     *
+     * @tparam T The element type, must be trivially copyable (no pointers into the process).
+     */
+    template <typename T>
+    class MmapVec {
+        static_assert(std::is_trivially_copyable_v<T>, "MmapVec elements must be trivially copyable");
+        static_assert(alignof(T) <= sizeof(detail::MmapVecHeader), "MmapVec elements must be at most 64-byte aligned");
+
+        static constexpr size_t header_size = sizeof(detail::MmapVecHeader);
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        MmapVec(const MmapVec&) = delete;
+        MmapVec& operator=(const MmapVec&) = delete;
+
+        MmapVec(MmapVec&& other) noexcept
+            : m_fd(std::exchange(other.m_fd, -1)),
+              m_map(std::exchange(other.m_map, nullptr)),
+              m_map_size(std::exchange(other.m_map_size, 0)) {}
+
+        MmapVec& operator=(MmapVec&& other) noexcept {
+            if (this != &other) {
+                close();
+                m_fd = std::exchange(other.m_fd, -1);
+                m_map = std::exchange(other.m_map, nullptr);
+                m_map_size = std::exchange(other.m_map_size, 0);
+            }
+            return *this;
+        }
+
+        ~MmapVec() {
+            close();
+        }
+
+        /**
+         * @brief Opens the vector stored in `path`, creating an empty one if the file is missing or empty.
+         *
+         * @param path The backing file.
+         * @param schema_version A version number for the record type; opening a file written
+         *        with a different one fails with Kind::VersionMismatch.
+         * @return Ok with the vector, or Err(MmapError) if the file cannot be opened or mapped,
+         *         or its header does not match T and `schema_version`.
+         */
+        [[nodiscard]] static auto open(const std::filesystem::path& path, const std::uint32_t schema_version = 0)
+            -> Result<MmapVec, MmapError>
+        {
+            MmapVec vec;
+            vec.m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (vec.m_fd < 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+            if (::flock(vec.m_fd, LOCK_EX | LOCK_NB) != 0) {
+                if (errno == EWOULDBLOCK) {
+                    return std::unexpected(MmapError{MmapError::Kind::Locked, 0});
+                }
+                return std::unexpected(detail::last_os_error());
+            }
+
+            struct stat st {};
+            if (::fstat(vec.m_fd, &st) != 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+
+            const auto file_size = static_cast<size_t>(st.st_size);
+            if (file_size == 0) {
+                if (const auto mapped = vec.remap(page_size); !mapped) {
+                    return std::unexpected(mapped.error());
+                }
+                detail::MmapVecHeader& header = vec.header();
+                std::memcpy(header.magic, detail::mmap_vec_magic, sizeof(header.magic));
+                header.format_version = detail::mmap_vec_format_version;
+                header.schema_version = schema_version;
+                header.byte_order = detail::mmap_vec_byte_order;
+                header.elem_size = sizeof(T);
+                header.elem_align = alignof(T);
+                header.len = 0;
+                return vec;
+            }
+
+            if (file_size < header_size) {
+                return std::unexpected(MmapError{MmapError::Kind::NotAnMmapVec, 0});
+            }
+            void* map = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, vec.m_fd, 0);
+            if (map == MAP_FAILED) {
+                return std::unexpected(detail::last_os_error());
+            }
+            vec.m_map = static_cast<std::byte*>(map);
+            vec.m_map_size = file_size;
+
+            if (const auto checked = vec.check_header(schema_version); !checked) {
+                return std::unexpected(checked.error());
+            }
+            return vec;
+        }
+
+        /**
+         * @brief Returns the number of elements in the vector.
+         *
+         * @return The length stored in the file header.
+         */
+        [[nodiscard]] size_t len() const noexcept {
+            return static_cast<size_t>(header().len);
+        }
+
+        /**
+         * @brief Checks if the vector is empty.
+         *
+         * @return True if the vector contains no elements, false otherwise.
+         */
+        [[nodiscard]] bool is_empty() const noexcept {
+            return len() == 0;
+        }
+
+        /**
+         * @brief Returns how many elements fit in the file without growing it.
+         *
+         * @return The capacity in elements.
+         */
+        [[nodiscard]] size_t capacity() const noexcept {
+            return (m_map_size - header_size) / sizeof(T);
+        }
+
+        /**
+         * @brief Returns the schema version recorded in the file header.
+         *
+         * @return The schema version passed to open() when the file was created.
+         */
+        [[nodiscard]] std::uint32_t schema_version() const noexcept {
+            return header().schema_version;
+        }
+
+        /**
+         * @brief Appends an element, growing the file if needed.
+         *
+         * @param value The value to append.
+         * @note Panics if the file cannot be grown, use try_push() to handle that.
+         */
+        void push(const T& value) {
+            if (len() == capacity()) [[unlikely]] {
+                const T copy = value;  // `value` may live in the mapping, which growing can move
+                reserve(1);
+                push_unchecked(copy);
+                return;
+            }
+            push_unchecked(value);
+        }
+
+        /**
+         * @brief Like push(), but reports failure instead of panicking.
+         *
+         * @param value The value to append.
+         * @return Ok, or Err(MmapError); the vector is unchanged on error.
+         */
+        [[nodiscard]] auto try_push(const T& value) -> Result<void, MmapError> {
+            if (len() == capacity()) [[unlikely]] {
+                const T copy = value;  // `value` may live in the mapping, which growing can move
+                if (const auto reserved = try_reserve(1); !reserved) {
+                    return reserved;
+                }
+                push_unchecked(copy);
+                return {};
+            }
+            push_unchecked(value);
+            return {};
+        }
+
+        /**
+         * @brief Appends all elements of a slice with a single growth and copy.
+         *
+         * @param slice The elements to append; may be a view of this vector.
+         * @note Panics if the file cannot be grown.
+         */
+        void extend_from_slice(std::span<const T> slice) {
+            if (slice.empty()) {
+                return;
+            }
+            // A slice of this vector is re-based after growing, which can move the mapping
+            const T* source = slice.data();
+            const bool aliased = !std::less<const T*>{}(source, data()) && std::less<const T*>{}(source, data() + len());
+            const size_t offset = aliased ? static_cast<size_t>(source - data()) : 0;
+            reserve(slice.size());
+            if (aliased) {
+                source = data() + offset;
+            }
+            std::memcpy(data() + len(), source, slice.size_bytes());
+            header().len += slice.size();
+        }
+
+        /**
+         * @brief Removes and returns the last element if it exists.
+         *
+         * @return An Option containing a copy of the last element, otherwise None.
+         */
+        [[nodiscard]] auto pop() noexcept -> Option<T> {
+            if (is_empty()) {
+                return None<T>();
+            }
+            --header().len;
+            return Some(T(data()[len()]));
+        }
+
+        /**
+         * @brief Retrieves a reference to the element at the specified index if it exists.
+         *
+         * @param index The index of the element to retrieve.
+         * @return An Option containing a reference into the mapping, otherwise None.
+         *         The reference is invalidated when the vector grows.
+         */
+        [[nodiscard]] auto get(const size_t index) noexcept -> Option<T&> {
+            if (index < len()) {
+                return Option<T&>(data()[index]);
+            }
+            return Option<T&>(_none);
+        }
+
+        /**
+         * @brief Retrieves a const reference to the element at the specified index if it exists.
+         *
+         * @param index The index of the element to retrieve.
+         * @return An Option containing a const reference into the mapping, otherwise None.
+         */
+        [[nodiscard]] auto get(const size_t index) const noexcept -> Option<const T&> {
+            if (index < len()) {
+                return Option<const T&>(data()[index]);
+            }
+            return Option<const T&>(_none);
+        }
+
+        /**
+         * @brief Accesses the element at the specified index.
+         *
+         * @param index The index of the element to access (must be within bounds).
+         * @return A reference to the element at the given index.
+         * @throws std::out_of_range if the index is out of bounds.
+         */
+        [[nodiscard]] auto operator[](const size_t index) -> T& {
+            if (index >= len()) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
+            }
+            return data()[index];
+        }
+
+        /**
+         * @brief Accesses the element at the specified index (const version).
+         *
+         * @param index The index of the element to access (must be within bounds).
+         * @return A const reference to the element at the given index.
+         * @throws std::out_of_range if the index is out of bounds.
+         */
+        [[nodiscard]] auto operator[](const size_t index) const -> const T& {
+            if (index >= len()) [[unlikely]] {
+                detail::throw_out_of_range("index out of bounds");
+            }
+            return data()[index];
+        }
+
+        /**
+         * @brief Returns a view over the elements, valid until the vector grows or shrinks.
+         *
+         * @return A std::span<const T> over the mapped elements.
+         */
+        [[nodiscard]] std::span<const T> as_slice() const noexcept {
+            return {data(), len()};
+        }
+
+        /**
+         * @brief Returns a mutable view over the elements, valid until the vector grows or shrinks.
+         *
+         * @return A std::span<T> over the mapped elements.
+         */
+        [[nodiscard]] std::span<T> as_mut_slice() noexcept {
+            return {data(), len()};
+        }
+
+        [[nodiscard]] const T* as_ptr() const noexcept { return data(); }
+        [[nodiscard]] T* as_mut_ptr() noexcept { return data(); }
+
+        [[nodiscard]] iterator begin() noexcept { return data(); }
+        [[nodiscard]] iterator end() noexcept { return data() + len(); }
+        [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+        [[nodiscard]] const_iterator end() const noexcept { return data() + len(); }
+
+        /**
+         * @brief Shortens the vector, keeping the first `new_len` elements. The file keeps its size.
+         *
+         * @param new_len The length to truncate to; no effect if it is not less than len().
+         */
+        void truncate(const size_t new_len) noexcept {
+            if (new_len < len()) {
+                header().len = new_len;
+            }
+        }
+
+        /**
+         * @brief Removes all elements. The file keeps its size.
+         */
+        void clear() noexcept {
+            header().len = 0;
+        }
+
+        /**
+         * @brief Reserves capacity for at least `additional` more elements, growing the file geometrically.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         * @note Panics if the file cannot be grown, use try_reserve() to handle that.
+         */
+        void reserve(const size_t additional) {
+            if (const auto reserved = try_reserve(additional); !reserved) [[unlikely]] {
+                detail::mmap_failure(reserved.error());
+            }
+        }
+
+        /**
+         * @brief Like reserve(), but reports failure instead of panicking.
+         *
+         * @param additional The number of additional elements to reserve space for.
+         * @return Ok, or Err(MmapError) if the capacity overflows or the file cannot be grown
+         *         or remapped; the vector is unchanged on error.
+         */
+        [[nodiscard]] auto try_reserve(const size_t additional) -> Result<void, MmapError> {
+            const size_t length = len();
+            if (additional <= capacity() - length) {
+                return {};
+            }
+            constexpr size_t max_elems = (std::numeric_limits<size_t>::max() - header_size - page_size) / sizeof(T);
+            if (additional > max_elems - length) {
+                return std::unexpected(MmapError{MmapError::Kind::CapacityOverflow, 0});
+            }
+            const size_t wanted = std::max(length + additional, std::min(capacity() * 2, max_elems));
+            return remap(growth::detail::round_up(header_size + wanted * sizeof(T), page_size));
+        }
+
+        /**
+         * @brief Shrinks the file to the smallest page multiple that holds the current elements.
+         *
+         * @return Ok, or Err(MmapError) if the file cannot be truncated or remapped.
+         */
+        [[nodiscard]] auto shrink_to_fit() -> Result<void, MmapError> {
+            const size_t size = growth::detail::round_up(header_size + len() * sizeof(T), page_size);
+            if (size >= m_map_size) {
+                return {};
+            }
+            return remap(size);
+        }
+
+        /**
+         * @brief Writes all modified pages (elements and header) to disk and waits for completion.
+         *
+         * @return Ok once the data is durable, or Err(MmapError) from msync.
+         */
+        [[nodiscard]] auto flush() -> Result<void, MmapError> {
+            if (::msync(m_map, m_map_size, MS_SYNC) != 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+            return {};
+        }
+
+        /**
+         * @brief Schedules all modified pages for write-back without waiting for it.
+         *
+         * @return Ok, or Err(MmapError) from msync.
+         */
+        [[nodiscard]] auto flush_async() -> Result<void, MmapError> {
+            if (::msync(m_map, m_map_size, MS_ASYNC) != 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+            return {};
+        }
+
+    private:
+        MmapVec() = default;
+
+        [[nodiscard]] detail::MmapVecHeader& header() noexcept {
+            return *std::launder(reinterpret_cast<detail::MmapVecHeader*>(m_map));
+        }
+
+        [[nodiscard]] const detail::MmapVecHeader& header() const noexcept {
+            return *std::launder(reinterpret_cast<const detail::MmapVecHeader*>(m_map));
+        }
+
+        [[nodiscard]] T* data() noexcept {
+            return std::launder(reinterpret_cast<T*>(m_map + header_size));
+        }
+
+        [[nodiscard]] const T* data() const noexcept {
+            return std::launder(reinterpret_cast<const T*>(m_map + header_size));
+        }
+
+        void push_unchecked(const T& value) noexcept {
+            std::memcpy(data() + len(), &value, sizeof(T));
+            ++header().len;
+        }
+
+        [[nodiscard]] auto check_header(const std::uint32_t schema_version) const -> Result<void, MmapError> {
+            const detail::MmapVecHeader& h = header();
+            if (std::memcmp(h.magic, detail::mmap_vec_magic, sizeof(h.magic)) != 0) {
+                return std::unexpected(MmapError{MmapError::Kind::NotAnMmapVec, 0});
+            }
+            if (h.format_version != detail::mmap_vec_format_version || h.schema_version != schema_version) {
+                return std::unexpected(MmapError{MmapError::Kind::VersionMismatch, 0});
+            }
+            if (h.byte_order != detail::mmap_vec_byte_order || h.elem_size != sizeof(T) || h.elem_align != alignof(T)) {
+                return std::unexpected(MmapError{MmapError::Kind::LayoutMismatch, 0});
+            }
+            if (h.len > capacity()) {
+                return std::unexpected(MmapError{MmapError::Kind::Corrupted, 0});
+            }
+            return {};
+        }
+
+        // Resizes the file and its mapping to `new_size` bytes. When shrinking, the mapping is
+        // reduced first so no mapped page ever lies past the end of the file (SIGBUS).
+        [[nodiscard]] auto remap(const size_t new_size) -> Result<void, MmapError> {
+            const bool shrinking = new_size < m_map_size;
+            if (!shrinking && ::ftruncate(m_fd, static_cast<off_t>(new_size)) != 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+
+            void* map = MAP_FAILED;
+            if (m_map == nullptr) {
+                map = ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+            } else {
+#if defined(__linux__)
+                map = ::mremap(m_map, m_map_size, new_size, MREMAP_MAYMOVE);
+#else
+                map = ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+                if (map != MAP_FAILED) {
+                    ::munmap(m_map, m_map_size);
+                }
+#endif
+            }
+            if (map == MAP_FAILED) {
+                return std::unexpected(detail::last_os_error());
+            }
+            m_map = static_cast<std::byte*>(map);
+            m_map_size = new_size;
+
+            if (shrinking && ::ftruncate(m_fd, static_cast<off_t>(new_size)) != 0) {
+                return std::unexpected(detail::last_os_error());
+            }
+            return {};
+        }
+
+        void close() noexcept {
+            if (m_map != nullptr) {
+                ::munmap(m_map, m_map_size);
+                m_map = nullptr;
+                m_map_size = 0;
+            }
+            if (m_fd >= 0) {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+
+        int m_fd = -1;
+        std::byte* m_map = nullptr;
+        size_t m_map_size = 0;
+    };
+}  // namespace oxide
+
+#endif // OXIDE_MMAP_VEC_HPP
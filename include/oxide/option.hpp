@@ -3,7 +3,11 @@
 #include <type_traits>  // For std::decay_t, std::enable_if_t, etc.
 #include <concepts>     // For std::invocable, std::same_as, etc.
 #include <utility>      // For std::forward, std::move
-#include <memory>       // For std::construct_at, std::destroy_at
+#include <memory>       // For std::construct_at, std::destroy_at, std::unique_ptr
+#include <cstdint>      // For std::uintptr_t, std::uint8_t
+#include <cstring>      // For std::memcpy
+#include <functional>   // For std::reference_wrapper, std::invoke
+#include <expected>     // For std::expected, std::unexpected (oxide::Result)
 
 #include "output.hpp"
 
@@ -13,64 +17,268 @@ namespace oxide {
     };
     inline constexpr none_t _none{};
 
+/// ============================================================================
+/// Niches, spare bit patterns of T that Option<T> uses as its None marker so it
+/// needs no separate flag and sizeof(Option<T>) == sizeof(T)
+/// ============================================================================
+    /**
+     * @brief Customization point declaring that T has a bit pattern no valid value ever uses.
+     *
+     * Specializations provide two static functions working on Option's storage slot:
+     * - `make_none(T* slot)` writes the None marker into the slot, which holds no live value.
+     *   Option never runs the destructor on the marker.
+     * - `is_none(const T* slot)` returns true if and only if the slot holds the marker.
+     *
+     * For types with a spare value, e.g. an enum with an unused enumerator, derive from
+     * sentinel_niche:
+     * @code
+     * template <> struct oxide::niche<Color> : oxide::sentinel_niche<Color, Color(0xff)> {};
+     * @endcode
+     *
+     * @tparam T The payload type; the primary template declares no niche.
+     */
+    template <typename T>
+    struct niche {};
+
+    template <typename T>
+    concept has_niche = requires(T* slot, const T* cslot) {
+        { niche<T>::is_none(cslot) } noexcept -> std::same_as<bool>;
+        { niche<T>::make_none(slot) } noexcept;
+    };
+
+    /**
+     * @brief A niche that marks None with one reserved value of T.
+     *
+     * @tparam T A trivially copyable payload type, typically an enum or an integer handle.
+     * @tparam Sentinel The value that never occurs as Some.
+     */
+    template <typename T, T Sentinel>
+    requires std::is_trivially_copyable_v<T>
+    struct sentinel_niche {
+        static constexpr void make_none(T* slot) noexcept { std::construct_at(slot, Sentinel); }
+        static constexpr bool is_none(const T* slot) noexcept { return *slot == Sentinel; }
+    };
+
+    namespace detail {
+        // The all-ones address is never a valid object, function or allocation address
+        template <typename P>
+        inline P invalid_pointer() noexcept {
+            return reinterpret_cast<P>(~std::uintptr_t{0});
+        }
+    }
+
+    // Raw pointers: None is the all-ones address, so Some(nullptr) stays a valid Some
+    template <typename T>
+    struct niche<T*> {
+        static void make_none(T** slot) noexcept { std::construct_at(slot, detail::invalid_pointer<T*>()); }
+        static bool is_none(T* const* slot) noexcept { return *slot == detail::invalid_pointer<T*>(); }
+    };
+
+    // unique_ptr with the default deleter: an empty unique_ptr stays a valid Some
+    template <typename T>
+    struct niche<std::unique_ptr<T>> {
+        using pointer = typename std::unique_ptr<T>::pointer;
+
+        static void make_none(std::unique_ptr<T>* slot) noexcept {
+            std::construct_at(slot, detail::invalid_pointer<pointer>());  // Never destroyed
+        }
+        static bool is_none(const std::unique_ptr<T>* slot) noexcept {
+            return slot->get() == detail::invalid_pointer<pointer>();
+        }
+    };
+
+    // reference_wrapper never holds null, its storage is a single pointer
+    template <typename T>
+    requires (sizeof(std::reference_wrapper<T>) == sizeof(T*))
+    struct niche<std::reference_wrapper<T>> {
+        static void make_none(std::reference_wrapper<T>* slot) noexcept {
+            const T* null = nullptr;
+            std::memcpy(static_cast<void*>(slot), &null, sizeof(null));
+        }
+        static bool is_none(const std::reference_wrapper<T>* slot) noexcept {
+            const T* address;
+            std::memcpy(&address, static_cast<const void*>(slot), sizeof(address));
+            return address == nullptr;
+        }
+    };
+
+    namespace detail {
+        // Option type produced by map(): lvalue references stay references, anything else is a value
+        template <typename R>
+        using option_map_t = std::conditional_t<std::is_lvalue_reference_v<R>, R, std::remove_cvref_t<R>>;
+
+        // Named so that the trivial special members below subsume the general ones
+        template <typename T>
+        concept option_copyable = std::is_copy_constructible_v<T>;
+        template <typename T>
+        concept option_movable = std::is_move_constructible_v<T>;
+
+        // The engaged flag fills the padding after T (up to 8 bytes), so the flag is written
+        // and read back at the same width when an Option is returned in registers
+        template <typename T>
+        using option_flag_t = std::conditional_t<alignof(T) >= 8, std::uint64_t,
+                              std::conditional_t<alignof(T) == 4, std::uint32_t,
+                              std::conditional_t<alignof(T) == 2, std::uint16_t, std::uint8_t>>>;
+
+        // The union member that is active while an Option is None, so a None Option is fully
+        // initialized and can be a constant expression
+        struct OptionEmpty {};
+
+        // Value storage for Option<T>: the payload in a union plus an engaged flag. A union
+        // rather than a byte buffer, held as a member rather than a base, lets GCC keep small
+        // payloads in registers.
+        template <typename T, bool Niche = has_niche<T>>
+        struct OptionStorage {
+            union {
+                OptionEmpty m_empty;
+                T m_value;
+            };
+            option_flag_t<T> m_has_value = 0;
+
+            constexpr OptionStorage() noexcept : m_empty() {}
+            template <typename... Args>
+            constexpr explicit OptionStorage(std::in_place_t, Args&&... args)
+                : m_value(std::forward<Args>(args)...), m_has_value(1) {}
+            ~OptionStorage() requires std::is_trivially_destructible_v<T> = default;
+            constexpr ~OptionStorage() {}  // Option destroys the payload
+
+            constexpr T* ptr() noexcept { return std::addressof(m_value); }
+            constexpr const T* ptr() const noexcept { return std::addressof(m_value); }
+
+            [[nodiscard]] constexpr bool engaged() const noexcept { return m_has_value != 0; }
+
+            template <typename... Args>
+            constexpr void construct(Args&&... args) {
+                std::construct_at(ptr(), std::forward<Args>(args)...);
+                m_has_value = 1;
+            }
+
+            // Destroys the payload, which must be present
+            constexpr void destroy() noexcept {
+                std::destroy_at(ptr());
+                m_has_value = 0;
+            }
+        };
+
+        // Niche storage: the union alone, holding either the payload or niche<T>'s None marker
+        template <typename T>
+        struct OptionStorage<T, true> {
+            union {
+                OptionEmpty m_empty;
+                T m_value;
+            };
+
+            constexpr OptionStorage() noexcept : m_empty() { niche<T>::make_none(ptr()); }
+            template <typename... Args>
+            constexpr explicit OptionStorage(std::in_place_t, Args&&... args) : m_value(std::forward<Args>(args)...) {}
+            ~OptionStorage() requires std::is_trivially_destructible_v<T> = default;
+            constexpr ~OptionStorage() {}  // Option destroys the payload, never the marker
+
+            constexpr T* ptr() noexcept { return std::addressof(m_value); }
+            constexpr const T* ptr() const noexcept { return std::addressof(m_value); }
+
+            [[nodiscard]] constexpr bool engaged() const noexcept { return !niche<T>::is_none(ptr()); }
+
+            template <typename... Args>
+            constexpr void construct(Args&&... args) {
+                // Restores the marker if the constructor throws
+                struct Guard {
+                    OptionStorage* self;
+                    constexpr ~Guard() { if (self) niche<T>::make_none(self->ptr()); }
+                } guard{this};
+                std::construct_at(ptr(), std::forward<Args>(args)...);
+                guard.self = nullptr;
+            }
+
+            constexpr void destroy() noexcept {
+                std::destroy_at(ptr());
+                niche<T>::make_none(ptr());
+            }
+        };
+    }
+
 /// ============================================================================
 /// Primary template for Option<T> (value-owning, like std::optional)
 /// ============================================================================
     template <typename T>
     class Option {
     private:
-        alignas(T) unsigned char m_storage[sizeof(T)]{};
-        bool m_has_value = false;
+        using Storage = detail::OptionStorage<T>;
+        Storage m_storage;
+
+        constexpr T* ptr() noexcept { return m_storage.ptr(); }
+        constexpr const T* ptr() const noexcept { return m_storage.ptr(); }
+        [[nodiscard]] constexpr bool engaged() const noexcept { return m_storage.engaged(); }
 
-        T* ptr() { return reinterpret_cast<T*>(m_storage); }
-        const T* ptr() const { return reinterpret_cast<const T*>(m_storage); }
+        template <typename... Args>
+        constexpr void construct(Args&&... args) { m_storage.construct(std::forward<Args>(args)...); }
+        constexpr void destroy() noexcept { m_storage.destroy(); }
 
     public:
         using value_type = T;
 
-        // Constructors
+        // Constructors. Copies and moves are trivial when T's are, so Option<int> is trivially
+        // copyable and travels in registers. As with std::optional, a move leaves the source
+        // engaged, holding a moved-from T, whether or not the move is trivial; take() empties it.
+        // Option is only as copyable and movable as T, so non-movable payloads are supported
+        // through the in_place constructor and emplace().
         constexpr Option() noexcept {}
         constexpr explicit Option(none_t) noexcept : Option() {}
-        constexpr Option(const Option& other) {
-            if (other.m_has_value) {
-                std::construct_at(ptr(), *other.ptr());
-                m_has_value = true;
+        constexpr Option(const Option&)
+            requires detail::option_copyable<T> && std::is_trivially_copy_constructible_v<T> = default;
+        constexpr Option(const Option& other) requires detail::option_copyable<T> {
+            if (other.engaged()) {
+                construct(*other.ptr());
             }
         }
-        constexpr Option(Option&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
-            if (other.m_has_value) {
-                std::construct_at(ptr(), std::move(*other.ptr()));
-                m_has_value = true;
-                other.reset();
+        constexpr Option(Option&&)
+            requires detail::option_movable<T> && std::is_trivially_move_constructible_v<T> = default;
+        constexpr Option(Option&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            requires detail::option_movable<T> {
+            if (other.engaged()) {
+                construct(std::move(*other.ptr()));
             }
         }
         template <typename U = T, std::enable_if_t<std::is_constructible_v<T, U&&>, int> = 0>
-        constexpr explicit Option(U&& value) : m_has_value(true) {
-            std::construct_at(ptr(), std::forward<U>(value));
-        }
+        constexpr explicit Option(U&& value) : m_storage(std::in_place, std::forward<U>(value)) {}
+
+        /**
+         * @brief Constructs the value directly inside the Option, without a temporary.
+         *
+         * @param args Arguments forwarded to T's constructor.
+         */
+        template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+        constexpr explicit Option(std::in_place_t, Args&&... args)
+            : m_storage(std::in_place, std::forward<Args>(args)...) {}
 
         // Destructor
-        ~Option() { reset(); }
+        ~Option() requires std::is_trivially_destructible_v<T> = default;
+        constexpr ~Option() { reset(); }
 
         // Assignment
-        Option& operator=(const Option& other) {
+        constexpr Option& operator=(const Option&)
+            requires detail::option_copyable<T> && std::is_trivially_copy_constructible_v<T> &&
+                     std::is_trivially_copy_assignable_v<T> && std::is_trivially_destructible_v<T> = default;
+        constexpr Option& operator=(const Option& other) requires detail::option_copyable<T> {
             if (this != &other) {
                 reset();
-                if (other.m_has_value) {
-                    std::construct_at(ptr(), *other.ptr());
-                    m_has_value = true;
+                if (other.engaged()) {
+                    construct(*other.ptr());
                 }
             }
             return *this;
         }
 
-        Option& operator=(Option&& other) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>) {
+        constexpr Option& operator=(Option&&)
+            requires detail::option_movable<T> && std::is_trivially_move_constructible_v<T> &&
+                     std::is_trivially_move_assignable_v<T> && std::is_trivially_destructible_v<T> = default;
+        constexpr Option& operator=(Option&& other) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>)
+            requires detail::option_movable<T> {
             if (this != &other) {
                 reset();
-                if (other.m_has_value) {
-                    std::construct_at(ptr(), std::move(*other.ptr()));
-                    m_has_value = true;
-                    other.reset();
+                if (other.engaged()) {
+                    construct(std::move(*other.ptr()));
                 }
             }
             return *this;
@@ -79,34 +287,33 @@ namespace oxide {
         template <typename U = T, std::enable_if_t<std::is_constructible_v<T, U&&>, int> = 0>
         constexpr Option& operator=(U&& value) {
             reset();
-            std::construct_at(ptr(), std::forward<U>(value));
-            m_has_value = true;
+            construct(std::forward<U>(value));
             return *this;
         }
 
-        Option& operator=(none_t) noexcept {
+        constexpr Option& operator=(none_t) noexcept {
             reset();
             return *this;
         }
 
         // Observers
-        [[nodiscard]] constexpr bool has_value() const noexcept { return m_has_value; }
+        [[nodiscard]] constexpr bool has_value() const noexcept { return engaged(); }
         constexpr explicit operator bool() const noexcept { return has_value(); }
 
         constexpr T& value() & {
-            if (!m_has_value) panic("called Option::value() on None");
+            if (!engaged()) panic("called Option::value() on None");
             return *ptr();
         }
         constexpr const T& value() const& {
-            if (!m_has_value) panic("called Option::value() on None");
+            if (!engaged()) panic("called Option::value() on None");
             return *ptr();
         }
         constexpr T&& value() && {
-            if (!m_has_value) panic("called Option::value() on None");
+            if (!engaged()) panic("called Option::value() on None");
             return std::move(*ptr());
         }
         constexpr const T&& value() const&& {
-            if (!m_has_value) panic("called Option::value() on None");
+            if (!engaged()) panic("called Option::value() on None");
             return std::move(*ptr());
         }
 
@@ -123,20 +330,35 @@ namespace oxide {
         constexpr const T&& operator*() const&& noexcept { return std::move(*ptr()); }
 
         // Modifiers
-        void reset() noexcept {
-            if (m_has_value) {
-                std::destroy_at(ptr());
-                m_has_value = false;
+        constexpr void reset() noexcept {
+            if (engaged()) {
+                destroy();
             }
         }
 
+        /**
+         * @brief Destroys any current value and constructs a new one in place.
+         *
+         * If T's constructor throws, the Option is left as None.
+         *
+         * @param args Arguments forwarded to T's constructor.
+         * @return A reference to the new value.
+         */
+        template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+        constexpr T& emplace(Args&&... args) {
+            reset();
+            construct(std::forward<Args>(args)...);
+            return *ptr();
+        }
+
         // Rust-like helpers
-        T& expect(const char* msg) & { if (!m_has_value) panic(msg); return *ptr(); }
-        const T& expect(const char* msg) const& { if (!m_has_value) panic(msg); return *ptr(); }
+        constexpr T& expect(const char* msg) & { if (!engaged()) panic(msg); return *ptr(); }
+        constexpr const T& expect(const char* msg) const& { if (!engaged()) panic(msg); return *ptr(); }
         template <typename U>
-        constexpr T unwrap_or(U&& default_value) const& { return m_has_value ? *ptr() : std::forward<U>(default_value); }
+        constexpr T unwrap_or(U&& default_value) const& { return engaged() ? *ptr() : std::forward<U>(default_value); }
         template <typename U>
-        constexpr T unwrap_or(U&& default_value) && { return m_has_value ? std::move(*ptr()) : std::forward<U>(default_value); }
+        constexpr T unwrap_or(U&& default_value) && { return engaged() ? std::move(*ptr()) : std::forward<U>(default_value); }
 
         // and_then, like std::optional::and_then (C++23)
         template <typename F>
@@ -166,8 +388,246 @@ namespace oxide {
             }
             return std::forward<F>(f)(value());
         }
+
+        // Combinators, like Rust's. The const& overloads copy the payload, the && overloads move it.
+
+        /**
+         * @brief Maps the contained value with `f`.
+         *
+         * @param f Called with the value if present.
+         * @return Some(f(value)), or None. A function returning an lvalue reference yields Option<U&>.
+         */
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr auto map(F&& f) const& -> Option<detail::option_map_t<std::invoke_result_t<F&&, const T&>>> {
+            using U = detail::option_map_t<std::invoke_result_t<F&&, const T&>>;
+            if (!engaged()) {
+                return Option<U>(_none);
+            }
+            return Option<U>(std::invoke(std::forward<F>(f), *ptr()));
+        }
+
+        template <typename F>
+        requires std::invocable<F&&, T&&>
+        constexpr auto map(F&& f) && -> Option<detail::option_map_t<std::invoke_result_t<F&&, T&&>>> {
+            using U = detail::option_map_t<std::invoke_result_t<F&&, T&&>>;
+            if (!engaged()) {
+                return Option<U>(_none);
+            }
+            return Option<U>(std::invoke(std::forward<F>(f), std::move(*ptr())));
+        }
+
+        /**
+         * @brief Keeps the value only if it satisfies `pred`.
+         *
+         * @param pred Called with a const reference to the value if present.
+         * @return This Option if it holds a value matching `pred`, otherwise None.
+         */
+        template <typename P>
+        requires std::predicate<P&&, const T&>
+        constexpr Option filter(P&& pred) const& {
+            if (engaged() && std::invoke(std::forward<P>(pred), std::as_const(*ptr()))) {
+                return *this;
+            }
+            return Option();
+        }
+
+        template <typename P>
+        requires std::predicate<P&&, const T&>
+        constexpr Option filter(P&& pred) && {
+            if (engaged() && std::invoke(std::forward<P>(pred), std::as_const(*ptr()))) {
+                return std::move(*this);
+            }
+            return Option();
+        }
+
+        /**
+         * @brief Returns this Option if it holds a value, otherwise the Option produced by `f`.
+         *
+         * @param f Called only when this Option is None; returns Option<T>.
+         */
+        template <typename F>
+        requires std::invocable<F&&> && std::same_as<std::remove_cvref_t<std::invoke_result_t<F&&>>, Option>
+        constexpr Option or_else(F&& f) const& {
+            if (engaged()) {
+                return *this;
+            }
+            return std::invoke(std::forward<F>(f));
+        }
+
+        template <typename F>
+        requires std::invocable<F&&> && std::same_as<std::remove_cvref_t<std::invoke_result_t<F&&>>, Option>
+        constexpr Option or_else(F&& f) && {
+            if (engaged()) {
+                return std::move(*this);
+            }
+            return std::invoke(std::forward<F>(f));
+        }
+
+        /**
+         * @brief Exclusive or, named `xor_` because `xor` is a C++ keyword.
+         *
+         * @param other The other Option.
+         * @return Whichever of the two holds a value if exactly one does, otherwise None.
+         */
+        constexpr Option xor_(Option other) const& {
+            if (engaged() != other.engaged()) {
+                return engaged() ? *this : std::move(other);
+            }
+            return Option();
+        }
+
+        constexpr Option xor_(Option other) && {
+            if (engaged() != other.engaged()) {
+                return engaged() ? std::move(*this) : std::move(other);
+            }
+            return Option();
+        }
+
+        /**
+         * @brief Pairs this value with the value of `other`.
+         *
+         * @param other The other Option.
+         * @return Some(pair(value, other value)) if both hold a value, otherwise None.
+         */
+        template <typename U>
+        constexpr auto zip(const Option<U>& other) const& -> Option<std::pair<T, U>> {
+            if (engaged() && other.has_value()) {
+                return Option<std::pair<T, U>>(std::pair<T, U>(*ptr(), *other));
+            }
+            return Option<std::pair<T, U>>();
+        }
+
+        template <typename U>
+        constexpr auto zip(Option<U> other) && -> Option<std::pair<T, U>> {
+            if (engaged() && other.has_value()) {
+                return Option<std::pair<T, U>>(std::pair<T, U>(std::move(*ptr()), std::move(*other)));
+            }
+            return Option<std::pair<T, U>>();
+        }
+
+        /**
+         * @brief Moves the value out, leaving None behind.
+         *
+         * @return The previous contents of this Option.
+         */
+        constexpr Option take() noexcept(std::is_nothrow_move_constructible_v<T>) {
+            Option taken(std::move(*this));
+            reset();
+            return taken;
+        }
+
+        /**
+         * @brief Stores `value`, returning what was there before.
+         *
+         * @param value The new value.
+         * @return The previous contents of this Option.
+         */
+        template <typename U = T>
+        requires std::constructible_from<T, U&&>
+        constexpr Option replace(U&& value) {
+            Option previous = take();
+            construct(std::forward<U>(value));
+            return previous;
+        }
+
+        /**
+         * @brief Returns the value, first storing the result of `f` if this Option is None.
+         *
+         * @param f Called only when this Option is None.
+         * @return A reference to the contained value.
+         */
+        template <typename F>
+        requires std::invocable<F&&> && std::constructible_from<T, std::invoke_result_t<F&&>>
+        constexpr T& get_or_insert_with(F&& f) {
+            if (!engaged()) {
+                construct(std::invoke(std::forward<F>(f)));
+            }
+            return *ptr();
+        }
+
+        /**
+         * @brief Returns the value, or the result of `f`. Unlike unwrap_or(), the fallback
+         *        is only built when it is needed.
+         *
+         * @param f Called only when this Option is None.
+         */
+        template <typename F>
+        requires std::invocable<F&&> && std::convertible_to<std::invoke_result_t<F&&>, T>
+        constexpr T unwrap_or_else(F&& f) const& {
+            if (engaged()) {
+                return *ptr();
+            }
+            return std::invoke(std::forward<F>(f));
+        }
+
+        template <typename F>
+        requires std::invocable<F&&> && std::convertible_to<std::invoke_result_t<F&&>, T>
+        constexpr T unwrap_or_else(F&& f) && {
+            if (engaged()) {
+                return std::move(*ptr());
+            }
+            return std::invoke(std::forward<F>(f));
+        }
+
+        /**
+         * @brief Returns the value, or a value-initialized T.
+         */
+        constexpr T unwrap_or_default() const& requires std::default_initializable<T> {
+            return engaged() ? *ptr() : T();
+        }
+
+        constexpr T unwrap_or_default() && requires std::default_initializable<T> {
+            return engaged() ? std::move(*ptr()) : T();
+        }
+
+        /**
+         * @brief Converts to a Result, using `error` for None.
+         *
+         * @param error The error to report when this Option is None.
+         * @return Ok(value), or Err(error).
+         */
+        template <typename E>
+        constexpr auto ok_or(E&& error) const& -> std::expected<T, std::decay_t<E>> {
+            if (engaged()) {
+                return std::expected<T, std::decay_t<E>>(std::in_place, *ptr());
+            }
+            return std::unexpected<std::decay_t<E>>(std::forward<E>(error));
+        }
+
+        template <typename E>
+        constexpr auto ok_or(E&& error) && -> std::expected<T, std::decay_t<E>> {
+            if (engaged()) {
+                return std::expected<T, std::decay_t<E>>(std::in_place, std::move(*ptr()));
+            }
+            return std::unexpected<std::decay_t<E>>(std::forward<E>(error));
+        }
+
+        /**
+         * @brief Calls `f` with the value if present, then passes this Option on.
+         *
+         * @param f Called with a const reference to the value.
+         */
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr const Option& inspect(F&& f) const& {
+            if (engaged()) {
+                std::invoke(std::forward<F>(f), std::as_const(*ptr()));
+            }
+            return *this;
+        }
+
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr Option inspect(F&& f) && {
+            if (engaged()) {
+                std::invoke(std::forward<F>(f), std::as_const(*ptr()));
+            }
+            return std::move(*this);
+        }
     };
 
+
 /// ============================================================================
 /// Partial specialization for Option<T&> (non-const reference)
 /// ============================================================================
@@ -188,17 +648,17 @@ namespace oxide {
         [[nodiscard]] constexpr bool has_value() const noexcept { return m_ptr != nullptr; }
         constexpr explicit operator bool() const noexcept { return has_value(); }
 
-        T& value() const {
+        constexpr T& value() const {
             if (!m_ptr) panic("called Option::value() on None");
             return *m_ptr;
         }
-        T& unwrap() const { return value(); }
+        constexpr T& unwrap() const { return value(); }
 
-        T* operator->() const noexcept { return m_ptr; }
-        T& operator*() const noexcept { return *m_ptr; }
+        constexpr T* operator->() const noexcept { return m_ptr; }
+        constexpr T& operator*() const noexcept { return *m_ptr; }
 
-        T& expect(const char* msg) const { if (!m_ptr) panic(msg); return *m_ptr; }
-        T& unwrap_or(T& default_value) const noexcept { return m_ptr ? *m_ptr : default_value; }
+        constexpr T& expect(const char* msg) const { if (!m_ptr) panic(msg); return *m_ptr; }
+        constexpr T& unwrap_or(T& default_value) const noexcept { return m_ptr ? *m_ptr : default_value; }
 
         // and_then, like std::optional::and_then (C++23)
         template <typename F>
@@ -214,6 +674,44 @@ namespace oxide {
             }
             return std::forward<F>(f)(value());
         }
+
+        // Combinators, see the primary template
+        template <typename F>
+        requires std::invocable<F&&, T&>
+        constexpr auto map(F&& f) const -> Option<detail::option_map_t<std::invoke_result_t<F&&, T&>>> {
+            using U = detail::option_map_t<std::invoke_result_t<F&&, T&>>;
+            if (!m_ptr) {
+                return Option<U>(_none);
+            }
+            return Option<U>(std::invoke(std::forward<F>(f), *m_ptr));
+        }
+
+        template <typename P>
+        requires std::predicate<P&&, const T&>
+        constexpr Option filter(P&& pred) const {
+            return m_ptr && std::invoke(std::forward<P>(pred), std::as_const(*m_ptr)) ? *this : Option();
+        }
+
+        template <typename F>
+        requires std::invocable<F&&> && std::same_as<std::remove_cvref_t<std::invoke_result_t<F&&>>, Option>
+        constexpr Option or_else(F&& f) const {
+            return m_ptr ? *this : std::invoke(std::forward<F>(f));
+        }
+
+        constexpr Option take() noexcept {
+            Option taken = *this;
+            m_ptr = nullptr;
+            return taken;
+        }
+
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr Option inspect(F&& f) const {
+            if (m_ptr) {
+                std::invoke(std::forward<F>(f), std::as_const(*m_ptr));
+            }
+            return *this;
+        }
     };
 
 /// ============================================================================
@@ -236,17 +734,17 @@ namespace oxide {
         [[nodiscard]] constexpr bool has_value() const noexcept { return m_ptr != nullptr; }
         constexpr explicit operator bool() const noexcept { return has_value(); }
 
-        const T& value() const {
+        constexpr const T& value() const {
             if (!m_ptr) panic("called Option::value() on None");
             return *m_ptr;
         }
-        const T& unwrap() const { return value(); }
+        constexpr const T& unwrap() const { return value(); }
 
-        const T* operator->() const noexcept { return m_ptr; }
-        const T& operator*() const noexcept { return *m_ptr; }
+        constexpr const T* operator->() const noexcept { return m_ptr; }
+        constexpr const T& operator*() const noexcept { return *m_ptr; }
 
-        const T& expect(const char* msg) const { if (!m_ptr) panic(msg); return *m_ptr; }
-        const T& unwrap_or(const T& default_value) const noexcept { return m_ptr ? *m_ptr : default_value; }
+        constexpr const T& expect(const char* msg) const { if (!m_ptr) panic(msg); return *m_ptr; }
+        constexpr const T& unwrap_or(const T& default_value) const noexcept { return m_ptr ? *m_ptr : default_value; }
 
         // and_then, like std::optional::and_then (C++23)
         template <typename F>
@@ -262,6 +760,44 @@ namespace oxide {
             }
             return std::forward<F>(f)(value());
         }
+
+        // Combinators, see the primary template
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr auto map(F&& f) const -> Option<detail::option_map_t<std::invoke_result_t<F&&, const T&>>> {
+            using U = detail::option_map_t<std::invoke_result_t<F&&, const T&>>;
+            if (!m_ptr) {
+                return Option<U>(_none);
+            }
+            return Option<U>(std::invoke(std::forward<F>(f), *m_ptr));
+        }
+
+        template <typename P>
+        requires std::predicate<P&&, const T&>
+        constexpr Option filter(P&& pred) const {
+            return m_ptr && std::invoke(std::forward<P>(pred), std::as_const(*m_ptr)) ? *this : Option();
+        }
+
+        template <typename F>
+        requires std::invocable<F&&> && std::same_as<std::remove_cvref_t<std::invoke_result_t<F&&>>, Option>
+        constexpr Option or_else(F&& f) const {
+            return m_ptr ? *this : std::invoke(std::forward<F>(f));
+        }
+
+        constexpr Option take() noexcept {
+            Option taken = *this;
+            m_ptr = nullptr;
+            return taken;
+        }
+
+        template <typename F>
+        requires std::invocable<F&&, const T&>
+        constexpr Option inspect(F&& f) const {
+            if (m_ptr) {
+                std::invoke(std::forward<F>(f), std::as_const(*m_ptr));
+            }
+            return *this;
+        }
     };
 
 /// ============================================================================
@@ -274,6 +810,15 @@ namespace oxide {
         return Option<T>(std::forward<T>(value));
     }
 
+    /**
+     * @brief Builds Some(T(args...)) with the value constructed in place, e.g. `Some<Message>(std::in_place, id, body)`.
+     */
+    template <typename T, typename... Args>
+    requires (!std::is_reference_v<T>) && std::constructible_from<T, Args&&...>
+    constexpr Option<T> Some(std::in_place_t, Args&&... args) {
+        return Option<T>(std::in_place, std::forward<Args>(args)...);
+    }
+
     template <typename T>
     constexpr Option<T&> Some(T& value) noexcept {
         return Option<T&>(value);
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_RELOCATE_HPP
+#define OXIDE_RELOCATE_HPP
+
+#include <cstddef>      // For std::size_t, std::byte
+#include <cstring>      // For std::memcpy, std::memmove
+#include <memory>       // For std::unique_ptr, std::shared_ptr, std::weak_ptr
+#include <optional>     // For std::optional
+#include <string>       // For std::basic_string
+#include <type_traits>  // For std::bool_constant, std::is_trivially_copyable_v
+#include <utility>      // For std::pair
+#include <vector>       // For std::vector
+
+namespace oxide {
+/// ============================================================================
+/// Trivial relocation, moving an object to new storage and ending the old one
+/// with a plain memcpy/memmove
+/// ============================================================================
+    /**
+     * @brief Opt-in trait for types that may be relocated bitwise.
+     *
+     * A type is trivially relocatable when moving an object to a new address and destroying the
+     * original is equivalent to copying its bytes and forgetting the original, i.e. it holds no
+     * pointer into itself and is not registered anywhere by address. Containers use it to shift
+     * elements with memmove instead of one move and one destructor call per element.
+     *
+     * Specialize it to true for your own handle types:
+     * @code
+     * template <> struct oxide::is_trivially_relocatable<MyHandle> : std::true_type {};
+     * @endcode
+     *
+     * @tparam T The type to query, trivially copyable types are always relocatable.
+     */
+    template <typename T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    template <typename T>
+    struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+
+    template <typename A, typename B>
+    struct is_trivially_relocatable<std::pair<A, B>>
+        : std::bool_constant<is_trivially_relocatable_v<A> && is_trivially_relocatable_v<B>> {};
+
+    template <typename T>
+    struct is_trivially_relocatable<std::optional<T>> : is_trivially_relocatable<T> {};
+
+    // MSVC debug builds register containers with their iterators by address
+#if !defined(_MSC_VER) || !defined(_ITERATOR_DEBUG_LEVEL) || _ITERATOR_DEBUG_LEVEL == 0
+    template <typename T>
+    struct is_trivially_relocatable<std::vector<T>> : std::true_type {};
+#endif
+
+    // libstdc++ strings point into their own small-string buffer, libc++ strings do not
+#if defined(_LIBCPP_VERSION)
+    template <typename C, typename Traits>
+    struct is_trivially_relocatable<std::basic_string<C, Traits>> : std::true_type {};
+#endif
+
+    namespace detail {
+        // Moves first[count] to first[0] and shifts [first, first + count) up one slot
+        template <typename T>
+        inline void relocate_rotate_right(T* first, const std::size_t count) noexcept {
+            alignas(T) std::byte last[sizeof(T)];
+            std::memcpy(last, static_cast<void*>(first + count), sizeof(T));
+            std::memmove(static_cast<void*>(first + 1), static_cast<const void*>(first), count * sizeof(T));
+            std::memcpy(static_cast<void*>(first), last, sizeof(T));
+        }
+
+        // Moves first[0] to first[count] and shifts (first, first + count] down one slot
+        template <typename T>
+        inline void relocate_rotate_left(T* first, const std::size_t count) noexcept {
+            alignas(T) std::byte head[sizeof(T)];
+            std::memcpy(head, static_cast<const void*>(first), sizeof(T));
+            std::memmove(static_cast<void*>(first), static_cast<const void*>(first + 1), count * sizeof(T));
+            std::memcpy(static_cast<void*>(first + count), head, sizeof(T));
+        }
+
+        // Exchanges the objects of two non-overlapping ranges by swapping their bytes
+        template <typename T>
+        inline void relocate_swap_ranges(T* a, T* b, const std::size_t count) noexcept {
+            std::byte buffer[4096];
+            auto* x = reinterpret_cast<std::byte*>(a);
+            auto* y = reinterpret_cast<std::byte*>(b);
+            for (std::size_t left = count * sizeof(T); left != 0;) {
+                const std::size_t n = left < sizeof(buffer) ? left : sizeof(buffer);
+                std::memcpy(buffer, x, n);
+                std::memcpy(x, y, n);
+                std::memcpy(y, buffer, n);
+                x += n;
+                y += n;
+                left -= n;
+            }
+        }
+
+        // Relocates `count` objects from `src` to uninitialized, non-overlapping `dest`
+        template <typename T>
+        inline void relocate_n(T* src, const std::size_t count, T* dest) noexcept {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(T));
+            }
+        }
+    }
+}  // namespace oxide
+
+#endif // OXIDE_RELOCATE_HPP
@@ -0,0 +1,384 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_SIMD_HPP
+#define OXIDE_SIMD_HPP
+
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <cstring>      // For std::memcpy
+#include <algorithm>    // For std::min
+#include <bit>          // For std::popcount
+#include <concepts>     // For std::same_as
+#include <limits>       // For std::numeric_limits
+#include <span>         // For std::span
+#include <type_traits>  // For std::is_integral_v, std::make_unsigned_t
+
+// Vector kernels are built with GCC/Clang vector extensions and compiled once per instruction
+// set through target attributes, so no -m flags are needed and the binary still runs on any x86-64
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define OXIDE_SIMD_X86 1
+#define OXIDE_SIMD_INLINE inline __attribute__((always_inline))
+#include <immintrin.h>
+#else
+#define OXIDE_SIMD_X86 0
+#endif
+
+namespace oxide::simd {
+/// ============================================================================
+/// Instruction set selection
+/// ============================================================================
+    enum class Isa : unsigned char {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512,
+    };
+
+    /**
+     * @brief Returns the widest instruction set supported by the running CPU, detected once.
+     *        AVX-512 requires the F and BW subsets (byte and word lanes).
+     */
+    [[nodiscard]] inline Isa detected_isa() noexcept {
+#if OXIDE_SIMD_X86
+        static const Isa isa = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+                return Isa::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return Isa::AVX2;
+            }
+            return Isa::SSE2;
+        }();
+        return isa;
+#else
+        return Isa::Scalar;
+#endif
+    }
+
+    /**
+     * @brief Element types with vectorized kernels: integers (except bool), float and double.
+     */
+    template <typename T>
+    concept element = (std::is_integral_v<T> && !std::same_as<T, bool>) ||
+                      std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail {
+    // Scalar reference kernels, also used for the tails of the vector kernels
+    template <typename T>
+    std::size_t position_scalar(const T* data, const std::size_t begin, const std::size_t end, const T needle) noexcept {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (data[i] == needle) return i;
+        }
+        return end;
+    }
+
+    template <typename T>
+    std::size_t rposition_scalar(const T* data, const std::size_t end, const T needle) noexcept {
+        for (std::size_t i = end; i > 0; --i) {
+            if (data[i - 1] == needle) return i - 1;
+        }
+        return static_cast<std::size_t>(-1);
+    }
+
+    template <typename T>
+    std::size_t count_scalar(const T* data, const std::size_t begin, const std::size_t end, const T needle) noexcept {
+        std::size_t count = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            count += data[i] == needle;
+        }
+        return count;
+    }
+
+    // Min (Max == false) or max ignoring NaNs, starting from `acc`
+    template <bool Max, typename T>
+    T extremum_scalar(const T* data, const std::size_t begin, const std::size_t end, T acc) noexcept {
+        for (std::size_t i = begin; i < end; ++i) {
+            acc = (Max ? acc < data[i] : data[i] < acc) ? data[i] : acc;
+        }
+        return acc;
+    }
+
+    // Integers wrap; lane types are unsigned so overflow is well defined
+    template <typename T>
+    struct sum_lane { using type = T; };
+
+    template <typename T> requires std::is_integral_v<T>
+    struct sum_lane<T> { using type = std::make_unsigned_t<T>; };
+
+    template <typename T>
+    using sum_lane_t = typename sum_lane<T>::type;
+
+    template <typename T>
+    sum_lane_t<T> sum_scalar(const T* data, const std::size_t begin, const std::size_t end, sum_lane_t<T> acc) noexcept {
+        for (std::size_t i = begin; i < end; ++i) {
+            acc += static_cast<sum_lane_t<T>>(data[i]);
+        }
+        return acc;
+    }
+
+    // Identity of the min/max fold: the largest (min) or smallest (max) value, infinities for floats
+    template <bool Max, typename T>
+    constexpr T extremum_identity() noexcept {
+        using limits = std::numeric_limits<T>;
+        if constexpr (std::is_floating_point_v<T>) {
+            return Max ? -limits::infinity() : limits::infinity();
+        } else {
+            return Max ? limits::lowest() : limits::max();
+        }
+    }
+}  // namespace detail
+}  // namespace oxide::simd
+
+#if OXIDE_SIMD_X86
+// Vectors are only passed between functions compiled for the same target, so the ABI notes do not apply.
+// GCC 12's AVX-512 min/max intrinsics trip -Wuninitialized on their own placeholder operand (PR105593).
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace oxide::simd::detail {
+    template <typename T, std::size_t Bytes>
+    struct vector {
+        typedef T type __attribute__((vector_size(Bytes)));
+    };
+
+    template <typename T, std::size_t Bytes>
+    using vec_t = typename vector<T, Bytes>::type;
+
+    template <typename V>
+    OXIDE_SIMD_INLINE V load(const void* src) noexcept {
+        V v;
+        std::memcpy(&v, src, sizeof(V));
+        return v;
+    }
+
+    // True if any lane of a comparison mask is set; halves are folded so the final test is on 16 bytes
+    template <typename M>
+    OXIDE_SIMD_INLINE bool any_lane(const M& mask) noexcept {
+        using W = vec_t<std::uint64_t, sizeof(M)>;
+        const W words = load<W>(&mask);
+        if constexpr (sizeof(M) > 16) {
+            using H = vec_t<std::uint64_t, sizeof(M) / 2>;
+            return any_lane(load<H>(&words) | load<H>(reinterpret_cast<const char*>(&words) + sizeof(H)));
+        } else {
+            return (words[0] | words[1]) != 0;
+        }
+    }
+}  // namespace oxide::simd::detail
+
+// Pragmas cannot take macro arguments directly, so targets are applied through _Pragma
+#define OXIDE_SIMD_STRINGIZE(x) #x
+#define OXIDE_SIMD_PRAGMA(x) _Pragma(OXIDE_SIMD_STRINGIZE(x))
+#if defined(__clang__)
+#define OXIDE_SIMD_TARGET_BEGIN(isa) OXIDE_SIMD_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+#define OXIDE_SIMD_TARGET_END OXIDE_SIMD_PRAGMA(clang attribute pop)
+#else
+#define OXIDE_SIMD_TARGET_BEGIN(isa) OXIDE_SIMD_PRAGMA(GCC push_options) OXIDE_SIMD_PRAGMA(GCC target(isa))
+#define OXIDE_SIMD_TARGET_END OXIDE_SIMD_PRAGMA(GCC pop_options)
+#endif
+
+OXIDE_SIMD_TARGET_BEGIN("avx512f,avx512bw")
+
+// Compilers lower generic 512-bit comparisons poorly (lane by lane), so these use mask registers directly
+namespace oxide::simd::detail::avx512_ops {
+    template <typename T, typename V>
+    std::uint64_t eq_mask(const V a, const V b) noexcept {
+        if constexpr (std::same_as<T, float>) {
+            return _mm512_cmp_ps_mask((__m512)a, (__m512)b, _CMP_EQ_OQ);
+        } else if constexpr (std::same_as<T, double>) {
+            return _mm512_cmp_pd_mask((__m512d)a, (__m512d)b, _CMP_EQ_OQ);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpeq_epi8_mask((__m512i)a, (__m512i)b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmpeq_epi16_mask((__m512i)a, (__m512i)b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_cmpeq_epi32_mask((__m512i)a, (__m512i)b);
+        } else {
+            return _mm512_cmpeq_epi64_mask((__m512i)a, (__m512i)b);
+        }
+    }
+
+    // min_ps/max_ps return the second operand when either is NaN, so `acc` goes second
+    template <bool Max, typename T, typename V>
+    V extremum(const V acc, const V v) noexcept {
+        constexpr bool s = std::is_signed_v<T>;
+        if constexpr (std::same_as<T, float>) {
+            return (V)(Max ? _mm512_max_ps((__m512)v, (__m512)acc) : _mm512_min_ps((__m512)v, (__m512)acc));
+        } else if constexpr (std::same_as<T, double>) {
+            return (V)(Max ? _mm512_max_pd((__m512d)v, (__m512d)acc) : _mm512_min_pd((__m512d)v, (__m512d)acc));
+        } else {
+            const auto x = (__m512i)acc;
+            const auto y = (__m512i)v;
+            if constexpr (sizeof(T) == 1) {
+                return (V)(Max ? (s ? _mm512_max_epi8(x, y) : _mm512_max_epu8(x, y)) : (s ? _mm512_min_epi8(x, y) : _mm512_min_epu8(x, y)));
+            } else if constexpr (sizeof(T) == 2) {
+                return (V)(Max ? (s ? _mm512_max_epi16(x, y) : _mm512_max_epu16(x, y)) : (s ? _mm512_min_epi16(x, y) : _mm512_min_epu16(x, y)));
+            } else if constexpr (sizeof(T) == 4) {
+                return (V)(Max ? (s ? _mm512_max_epi32(x, y) : _mm512_max_epu32(x, y)) : (s ? _mm512_min_epi32(x, y) : _mm512_min_epu32(x, y)));
+            } else {
+                return (V)(Max ? (s ? _mm512_max_epi64(x, y) : _mm512_max_epu64(x, y)) : (s ? _mm512_min_epi64(x, y) : _mm512_min_epu64(x, y)));
+            }
+        }
+    }
+}  // namespace oxide::simd::detail::avx512_ops
+
+OXIDE_SIMD_TARGET_END
+
+#define OXIDE_SIMD_NAMESPACE sse2
+#define OXIDE_SIMD_TARGET "sse2"
+#define OXIDE_SIMD_BYTES 16
+#include "simd_kernels.hpp"
+
+#define OXIDE_SIMD_NAMESPACE avx2
+#define OXIDE_SIMD_TARGET "avx2"
+#define OXIDE_SIMD_BYTES 32
+#include "simd_kernels.hpp"
+
+#define OXIDE_SIMD_NAMESPACE avx512
+#define OXIDE_SIMD_TARGET "avx512f,avx512bw"
+#define OXIDE_SIMD_BYTES 64
+#include "simd_kernels.hpp"
+
+#pragma GCC diagnostic pop
+#endif
+
+namespace oxide::simd {
+namespace detail {
+    // Calls `f` with the kernel set for `isa`, clamped to what the CPU supports
+    template <typename F>
+    decltype(auto) dispatch(const Isa isa, F&& f) {
+#if OXIDE_SIMD_X86
+        switch (std::min(isa, detected_isa())) {
+            case Isa::AVX512: return f(static_cast<avx512::Kernels*>(nullptr));
+            case Isa::AVX2: return f(static_cast<avx2::Kernels*>(nullptr));
+            case Isa::SSE2: return f(static_cast<sse2::Kernels*>(nullptr));
+            case Isa::Scalar: break;
+        }
+#endif
+        return f(static_cast<void*>(nullptr));
+    }
+}  // namespace detail
+
+/// ============================================================================
+/// Kernels, each dispatched to the widest supported instruction set by default
+/// ============================================================================
+    /**
+     * @brief Returns the index of the first element equal to `needle`.
+     *
+     * @param data The elements to search.
+     * @param needle The value to look for (a NaN never matches).
+     * @param isa The widest instruction set to use.
+     * @return The index, or data.size() if there is no match.
+     */
+    template <element T>
+    [[nodiscard]] std::size_t position(std::span<const T> data, const T needle, const Isa isa = detected_isa()) noexcept {
+        return detail::dispatch(isa, [&]<typename K>(K*) {
+            if constexpr (std::same_as<K, void>) {
+                return detail::position_scalar(data.data(), 0, data.size(), needle);
+            } else {
+                return K::position(data.data(), data.size(), needle);
+            }
+        });
+    }
+
+    /**
+     * @brief Returns the index of the last element equal to `needle`.
+     *
+     * @param data The elements to search.
+     * @param needle The value to look for (a NaN never matches).
+     * @param isa The widest instruction set to use.
+     * @return The index, or std::size_t(-1) if there is no match.
+     */
+    template <element T>
+    [[nodiscard]] std::size_t rposition(std::span<const T> data, const T needle, const Isa isa = detected_isa()) noexcept {
+        return detail::dispatch(isa, [&]<typename K>(K*) {
+            if constexpr (std::same_as<K, void>) {
+                return detail::rposition_scalar(data.data(), data.size(), needle);
+            } else {
+                return K::rposition(data.data(), data.size(), needle);
+            }
+        });
+    }
+
+    /**
+     * @brief Returns the number of elements equal to `needle`.
+     *
+     * @param data The elements to search.
+     * @param needle The value to count (a NaN never matches).
+     * @param isa The widest instruction set to use.
+     */
+    template <element T>
+    [[nodiscard]] std::size_t count(std::span<const T> data, const T needle, const Isa isa = detected_isa()) noexcept {
+        return detail::dispatch(isa, [&]<typename K>(K*) {
+            if constexpr (std::same_as<K, void>) {
+                return detail::count_scalar(data.data(), 0, data.size(), needle);
+            } else {
+                return K::count(data.data(), data.size(), needle);
+            }
+        });
+    }
+
+    /**
+     * @brief Returns the smallest (Max == false) or largest element, ignoring NaNs. For an empty
+     *        or all-NaN input the fold identity is returned (+inf/-inf, or the integer limits).
+     *
+     * @tparam Max Whether to return the largest element.
+     * @param data The elements to scan.
+     * @param isa The widest instruction set to use.
+     */
+    template <bool Max, element T>
+    [[nodiscard]] T extremum(std::span<const T> data, const Isa isa = detected_isa()) noexcept {
+        return detail::dispatch(isa, [&]<typename K>(K*) {
+            if constexpr (std::same_as<K, void>) {
+                return detail::extremum_scalar<Max>(data.data(), 0, data.size(), detail::extremum_identity<Max, T>());
+            } else {
+                return K::template extremum<Max>(data.data(), data.size());
+            }
+        });
+    }
+
+    /**
+     * @brief Returns the sum of the elements. Integer sums wrap around on overflow; floating-point
+     *        sums are accumulated in several lanes, so rounding can differ from a sequential loop.
+     *
+     * @param data The elements to add.
+     * @param isa The widest instruction set to use.
+     */
+    template <element T>
+    [[nodiscard]] T sum(std::span<const T> data, const Isa isa = detected_isa()) noexcept {
+        return static_cast<T>(detail::dispatch(isa, [&]<typename K>(K*) {
+            if constexpr (std::same_as<K, void>) {
+                return detail::sum_scalar(data.data(), 0, data.size(), detail::sum_lane_t<T>{});
+            } else {
+                return K::template sum<T>(data.data(), data.size());
+            }
+        }));
+    }
+}  // namespace oxide::simd
+
+#endif // OXIDE_SIMD_HPP
@@ -0,0 +1,175 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+// Vector kernels for one instruction set. This file has no include guard on purpose: oxide/simd.hpp
+// includes it once per instruction set, with OXIDE_SIMD_NAMESPACE, OXIDE_SIMD_TARGET and
+// OXIDE_SIMD_BYTES defined, so every function below is compiled for that target.
+
+OXIDE_SIMD_TARGET_BEGIN(OXIDE_SIMD_TARGET)
+
+namespace oxide::simd::detail::OXIDE_SIMD_NAMESPACE {
+    struct Kernels {
+        static constexpr std::size_t bytes = OXIDE_SIMD_BYTES;
+
+        template <typename T>
+        using V = vec_t<T, bytes>;
+
+        // Lanes of `a` equal to `b`: a lane mask below 64 bytes, a bitmask (mask register) at 64 bytes
+        template <typename T>
+        static auto match(const V<T> a, const V<T> b) noexcept {
+            if constexpr (bytes == 64) {
+                return avx512_ops::eq_mask<T>(a, b);
+            } else {
+                return a == b;
+            }
+        }
+
+        template <typename M>
+        static bool any(const M mask) noexcept {
+            if constexpr (std::is_integral_v<M>) {
+                return mask != 0;
+            } else {
+                return any_lane(mask);
+            }
+        }
+
+        // Lane-wise min (Max == false) or max, keeping `acc` where `v` is NaN
+        template <bool Max, typename T>
+        static V<T> select(const V<T> acc, const V<T> v) noexcept {
+            if constexpr (bytes == 64) {
+                return avx512_ops::extremum<Max, T>(acc, v);
+            } else {
+                return (Max ? acc < v : v < acc) ? v : acc;
+            }
+        }
+
+        // Each kernel processes four vectors per iteration and finishes the tail with the scalar kernel
+        template <typename T>
+        static std::size_t position(const T* data, const std::size_t n, const T needle) noexcept {
+            constexpr std::size_t lanes = bytes / sizeof(T);
+            const V<T> splat = V<T>{} + needle;
+            std::size_t i = 0;
+            for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                const auto hit = match<T>(load<V<T>>(data + i), splat) | match<T>(load<V<T>>(data + i + lanes), splat) |
+                                 match<T>(load<V<T>>(data + i + 2 * lanes), splat) |
+                                 match<T>(load<V<T>>(data + i + 3 * lanes), splat);
+                if (any(hit)) {
+                    return position_scalar(data, i, i + 4 * lanes, needle);
+                }
+            }
+            return position_scalar(data, i, n, needle);
+        }
+
+        template <typename T>
+        static std::size_t rposition(const T* data, const std::size_t n, const T needle) noexcept {
+            constexpr std::size_t lanes = bytes / sizeof(T);
+            const V<T> splat = V<T>{} + needle;
+            std::size_t end = n;
+            for (; end >= 4 * lanes; end -= 4 * lanes) {
+                const T* p = data + end - 4 * lanes;
+                const auto hit = match<T>(load<V<T>>(p), splat) | match<T>(load<V<T>>(p + lanes), splat) |
+                                 match<T>(load<V<T>>(p + 2 * lanes), splat) | match<T>(load<V<T>>(p + 3 * lanes), splat);
+                if (any(hit)) {
+                    break;
+                }
+            }
+            return rposition_scalar(data, end, needle);
+        }
+
+        template <typename T>
+        static std::size_t count(const T* data, const std::size_t n, const T needle) noexcept {
+            constexpr std::size_t lanes = bytes / sizeof(T);
+            const V<T> splat = V<T>{} + needle;
+            std::size_t count = 0;
+            std::size_t i = 0;
+            if constexpr (bytes == 64) {
+                for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                    for (std::size_t k = 0; k < 4; ++k) {
+                        count += static_cast<std::size_t>(std::popcount(match<T>(load<V<T>>(data + i + k * lanes), splat)));
+                    }
+                }
+            } else {
+                using M = decltype(V<T>{} == V<T>{});
+                using lane = std::remove_cvref_t<decltype(M{}[0])>;
+                // Mask lanes are -1 on a hit; narrow counters are flushed before they can overflow
+                constexpr std::size_t flush = std::min<std::size_t>(std::numeric_limits<lane>::max() / 4, 1 << 20);
+                while (i + 4 * lanes <= n) {
+                    M acc{};
+                    for (std::size_t round = 0; round < flush && i + 4 * lanes <= n; ++round, i += 4 * lanes) {
+                        for (std::size_t k = 0; k < 4; ++k) {
+                            acc -= match<T>(load<V<T>>(data + i + k * lanes), splat);
+                        }
+                    }
+                    for (std::size_t k = 0; k < lanes; ++k) {
+                        count += static_cast<std::make_unsigned_t<lane>>(acc[k]);
+                    }
+                }
+            }
+            return count + count_scalar(data, i, n, needle);
+        }
+
+        template <bool Max, typename T>
+        static T extremum(const T* data, const std::size_t n) noexcept {
+            constexpr std::size_t lanes = bytes / sizeof(T);
+            constexpr T identity = extremum_identity<Max, T>();
+            V<T> acc[4] = {V<T>{} + identity, V<T>{} + identity, V<T>{} + identity, V<T>{} + identity};
+            std::size_t i = 0;
+            for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                for (std::size_t k = 0; k < 4; ++k) {
+                    acc[k] = select<Max, T>(acc[k], load<V<T>>(data + i + k * lanes));
+                }
+            }
+            const V<T> folded = select<Max, T>(select<Max, T>(acc[0], acc[1]), select<Max, T>(acc[2], acc[3]));
+            T result = identity;
+            for (std::size_t j = 0; j < lanes; ++j) {
+                result = (Max ? result < folded[j] : folded[j] < result) ? folded[j] : result;
+            }
+            return extremum_scalar<Max>(data, i, n, result);
+        }
+
+        template <typename T>
+        static sum_lane_t<T> sum(const T* data, const std::size_t n) noexcept {
+            using S = sum_lane_t<T>;
+            constexpr std::size_t lanes = bytes / sizeof(T);
+            V<S> acc[4] = {};
+            std::size_t i = 0;
+            for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                for (std::size_t k = 0; k < 4; ++k) {
+                    acc[k] += load<V<S>>(data + i + k * lanes);
+                }
+            }
+            const V<S> total = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            S result{};
+            for (std::size_t j = 0; j < lanes; ++j) {
+                result += total[j];
+            }
+            return sum_scalar(data, i, n, result);
+        }
+    };
+}  // namespace oxide::simd::detail::OXIDE_SIMD_NAMESPACE
+
+OXIDE_SIMD_TARGET_END
+
+#undef OXIDE_SIMD_NAMESPACE
+#undef OXIDE_SIMD_TARGET
+#undef OXIDE_SIMD_BYTES
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_SLICE_HPP
+#define OXIDE_SLICE_HPP
+
+#include <cstddef>     // For std::size_t, std::ptrdiff_t
+#include <algorithm>   // For std::min
+#include <compare>     // For std::strong_ordering
+#include <iterator>    // For std::random_access_iterator_tag
+#include <ranges>      // For std::ranges::view_interface, std::ranges::enable_borrowed_range
+#include <span>        // For std::span, std::dynamic_extent
+
+namespace oxide {
+/// ============================================================================
+/// Chunks<T, Extent>, a view over consecutive sub-slices of a span
+/// ============================================================================
+    /**
+     * @brief A zero-allocation, random-access view that yields sub-slices of `size` elements
+     *        starting every `step` elements. Backs Vec::chunks (step == size), Vec::windows
+     *        (step == 1) and Vec::as_chunks<N> (a fixed Extent, so each chunk is a std::span<T, N>
+     *        the compiler can unroll and vectorize). Only Vec::chunks yields a shorter last chunk;
+     *        the exact variants expose the leftover elements through remainder().
+     *
+     * @tparam T The element type, const-qualified for read-only chunks.
+     * @tparam Extent The static chunk length, or std::dynamic_extent.
+     */
+    template <typename T, std::size_t Extent = std::dynamic_extent>
+    class Chunks : public std::ranges::view_interface<Chunks<T, Extent>> {
+    public:
+        using chunk_type = std::span<T, Extent>;
+
+        class iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = chunk_type;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(T* data, const std::size_t len, const std::size_t size, const std::size_t step,
+                     const difference_type index) noexcept
+                : data_(data), len_(len), size_(size), step_(step), index_(index) {}
+
+            [[nodiscard]] chunk_type operator*() const noexcept { return (*this)[0]; }
+
+            [[nodiscard]] chunk_type operator[](const difference_type n) const noexcept {
+                const std::size_t offset = static_cast<std::size_t>(index_ + n) * step_;
+                if constexpr (Extent == std::dynamic_extent) {
+                    return chunk_type(data_ + offset, std::min(size_, len_ - offset));
+                } else {
+                    return chunk_type(data_ + offset, Extent);
+                }
+            }
+
+            iterator& operator++() noexcept { ++index_; return *this; }
+            iterator operator++(int) noexcept { auto tmp = *this; ++index_; return tmp; }
+            iterator& operator--() noexcept { --index_; return *this; }
+            iterator operator--(int) noexcept { auto tmp = *this; --index_; return tmp; }
+            iterator& operator+=(const difference_type n) noexcept { index_ += n; return *this; }
+            iterator& operator-=(const difference_type n) noexcept { index_ -= n; return *this; }
+
+            friend iterator operator+(iterator it, const difference_type n) noexcept { return it += n; }
+            friend iterator operator+(const difference_type n, iterator it) noexcept { return it += n; }
+            friend iterator operator-(iterator it, const difference_type n) noexcept { return it -= n; }
+            friend difference_type operator-(const iterator& a, const iterator& b) noexcept { return a.index_ - b.index_; }
+            friend bool operator==(const iterator& a, const iterator& b) noexcept { return a.index_ == b.index_; }
+            friend std::strong_ordering operator<=>(const iterator& a, const iterator& b) noexcept { return a.index_ <=> b.index_; }
+
+        private:
+            T* data_ = nullptr;
+            std::size_t len_ = 0;
+            std::size_t size_ = 0;
+            std::size_t step_ = 1;
+            difference_type index_ = 0;
+        };
+
+        Chunks() = default;
+
+        /**
+         * @param slice The elements to split.
+         * @param size The number of elements per chunk (must be non-zero).
+         * @param step The distance between the starts of consecutive chunks.
+         * @param count The number of chunks yielded.
+         */
+        Chunks(std::span<T> slice, const std::size_t size, const std::size_t step, const std::size_t count) noexcept
+            : m_slice(slice), m_size(size), m_step(step), m_count(count) {}
+
+        [[nodiscard]] iterator begin() const noexcept {
+            return iterator(m_slice.data(), m_slice.size(), m_size, m_step, 0);
+        }
+
+        [[nodiscard]] iterator end() const noexcept {
+            return iterator(m_slice.data(), m_slice.size(), m_size, m_step, static_cast<std::ptrdiff_t>(m_count));
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_count; }
+
+        /**
+         * @brief Returns the elements not covered by any chunk (always empty for ragged chunks and windows).
+         *
+         * @return A span over the trailing elements.
+         */
+        [[nodiscard]] std::span<T> remainder() const noexcept {
+            const std::size_t covered = m_count == 0 ? 0 : std::min(m_slice.size(), (m_count - 1) * m_step + m_size);
+            return m_slice.subspan(m_step == 1 ? m_slice.size() : covered);
+        }
+
+    private:
+        std::span<T> m_slice;
+        std::size_t m_size = 1;
+        std::size_t m_step = 1;
+        std::size_t m_count = 0;
+    };
+}  // namespace oxide
+
+template <typename T, std::size_t Extent>
+inline constexpr bool std::ranges::enable_borrowed_range<oxide::Chunks<T, Extent>> = true;
+
+#endif // OXIDE_SLICE_HPP
@@ -0,0 +1,175 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_SORT_HPP
+#define OXIDE_SORT_HPP
+
+#include <cstddef>     // For std::size_t
+#include <cstdint>     // For std::uint32_t, std::uint64_t
+#include <algorithm>   // For std::sort, std::inplace_merge, std::max, std::min
+#include <array>       // For std::array
+#include <bit>         // For std::bit_cast
+#include <concepts>    // For std::same_as
+#include <functional>  // For std::ranges::less
+#include <type_traits> // For std::make_unsigned_t, std::is_integral_v
+#include <utility>     // For std::move, std::swap
+#include <vector>      // For std::vector
+
+#include "thread_pool.hpp"
+
+namespace oxide::detail {
+    /// Below this many elements comparison sorting beats the radix passes
+    inline constexpr std::size_t radix_threshold = 256;
+
+    /// Smallest chunk sorted on its own by parallel_sort
+    inline constexpr std::size_t parallel_sort_min_chunk = 1 << 15;
+
+    /**
+     * @brief Key types that have an order-preserving unsigned bit representation.
+     */
+    template <typename K>
+    concept radix_key = (std::is_integral_v<K> && !std::same_as<K, bool>) ||
+                        std::same_as<K, float> || std::same_as<K, double>;
+
+    /**
+     * @brief Maps a key to an unsigned integer of the same width whose natural order matches
+     *        the key's order. Floats follow the IEEE-754 total order (-NaN < -inf < ... < +inf < +NaN).
+     */
+    template <radix_key K>
+    constexpr auto radix_bits(const K key) noexcept {
+        if constexpr (std::is_floating_point_v<K>) {
+            using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+            constexpr U sign = U{1} << (sizeof(U) * 8 - 1);
+            const U bits = std::bit_cast<U>(key);
+            return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+        } else if constexpr (std::is_signed_v<K>) {
+            using U = std::make_unsigned_t<K>;
+            constexpr U sign = U{1} << (sizeof(U) * 8 - 1);
+            return static_cast<U>(static_cast<U>(key) ^ sign);
+        } else {
+            return static_cast<std::make_unsigned_t<K>>(key);
+        }
+    }
+
+    /**
+     * @brief The order radix_sort produces, as a comparator: the IEEE-754 total order for floats,
+     *        the usual order for integers. Unlike `<`, it is a strict weak order even with NaNs.
+     */
+    struct radix_less {
+        template <radix_key K>
+        constexpr bool operator()(const K a, const K b) const noexcept {
+            return radix_bits(a) < radix_bits(b);
+        }
+    };
+
+    /// The comparator that agrees with sort_unstable() and par_sort() on T
+    template <typename T>
+    using sort_less = std::conditional_t<radix_key<T>, radix_less, std::ranges::less>;
+
+    /**
+     * @brief Stable LSD radix sort of `[data, data + n)` by the unsigned value `bits(element)`,
+     *        one byte per pass. Passes in which every element falls in the same bucket are skipped.
+     *
+     * @param data The elements to sort.
+     * @param n The number of elements.
+     * @param scratch A buffer of at least n elements used as the ping-pong target.
+     * @param bits Maps an element to its unsigned sort key.
+     */
+    template <typename T, typename BitsFn>
+    void radix_sort(T* data, const std::size_t n, T* scratch, BitsFn bits) {
+        using U = decltype(bits(*data));
+        constexpr std::size_t passes = sizeof(U);
+
+        // One read pass builds the histograms of every byte
+        std::vector<std::array<std::size_t, 256>> counts(passes, std::array<std::size_t, 256>{});
+        for (std::size_t i = 0; i < n; ++i) {
+            const U key = bits(data[i]);
+            for (std::size_t p = 0; p < passes; ++p) {
+                ++counts[p][static_cast<std::size_t>(key >> (p * 8)) & 0xff];
+            }
+        }
+
+        T* src = data;
+        T* dst = scratch;
+        for (std::size_t p = 0; p < passes; ++p) {
+            auto& count = counts[p];
+            if (std::ranges::find(count, n) != count.end()) {
+                continue;  // All elements share this byte
+            }
+            std::size_t offset = 0;
+            for (auto& c : count) {
+                offset += std::exchange(c, offset);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto bucket = static_cast<std::size_t>(bits(src[i]) >> (p * 8)) & 0xff;
+                dst[count[bucket]++] = std::move(src[i]);
+            }
+            std::swap(src, dst);
+        }
+        if (src != data) {
+            std::move(src, src + n, data);
+        }
+    }
+
+    // Sorts the halves of [first, first + n) in parallel, `depth` times over, then merges them
+    template <typename T, typename Compare, typename ChunkSort>
+    void parallel_sort_split(ThreadPool& pool, T* first, const std::size_t n, const std::size_t depth,
+                             const Compare& compare, const ChunkSort& sort_chunk) {
+        if (depth == 0) {
+            sort_chunk(first, first + n);
+            return;
+        }
+        const std::size_t mid = n / 2;
+        pool.join([&] { parallel_sort_split(pool, first, mid, depth - 1, compare, sort_chunk); },
+                  [&] { parallel_sort_split(pool, first + mid, n - mid, depth - 1, compare, sort_chunk); });
+        std::inplace_merge(first, first + mid, first + n, compare);
+    }
+
+    /**
+     * @brief Sorts `[first, first + n)` with `compare` on `pool`. The range is split into up to
+     *        num_threads() chunks, each chunk is sorted by `sort_chunk`, and neighbouring chunks
+     *        are merged pairwise, the merges of one round running in parallel. Called from one of
+     *        the pool's workers it splits the work there instead of starting new threads.
+     *        Exceptions from `compare` or `sort_chunk` are rethrown to the caller.
+     *
+     * @param pool The pool to run on, normally ThreadPool::global().
+     * @param first The first element.
+     * @param n The number of elements.
+     * @param compare The strict weak ordering used when merging; must agree with `sort_chunk`.
+     * @param sort_chunk Sorts one chunk, called as sort_chunk(begin, end).
+     */
+    template <typename T, typename Compare, typename ChunkSort>
+    void parallel_sort(ThreadPool& pool, T* first, const std::size_t n, Compare compare, ChunkSort sort_chunk) {
+        std::size_t depth = 0;
+        while ((std::size_t{2} << depth) <= pool.num_threads() && n >> (depth + 1) >= parallel_sort_min_chunk) {
+            ++depth;
+        }
+        if (depth == 0) {
+            sort_chunk(first, first + n);
+            return;
+        }
+        pool.install([&] { parallel_sort_split(pool, first, n, depth, compare, sort_chunk); });
+    }
+}  // namespace oxide::detail
+
+#endif // OXIDE_SORT_HPP
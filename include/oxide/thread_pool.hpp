@@ -0,0 +1,436 @@
+/*
+ *  Copyright (C) 2025 Igal Alkon and ALKONTEK
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a
+ *  copy of this software and associated documentation files (the "Software"),
+ *  to deal in the Software without restriction, including without limitation
+ *  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *  and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included
+ *  in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ *  DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef OXIDE_THREAD_POOL_HPP
+#define OXIDE_THREAD_POOL_HPP
+
+#include <cstddef>             // For std::size_t
+#include <cstdlib>             // For std::getenv, std::strtoul
+#include <algorithm>           // For std::max
+#include <atomic>              // For std::atomic
+#include <condition_variable>  // For std::condition_variable
+#include <deque>               // For std::deque
+#include <exception>           // For std::exception_ptr
+#include <memory>              // For std::unique_ptr
+#include <mutex>               // For std::mutex, std::lock_guard, std::unique_lock
+#include <optional>            // For std::optional
+#include <thread>              // For std::jthread, std::this_thread::yield
+#include <type_traits>         // For std::invoke_result_t
+#include <vector>              // For std::vector
+
+#include "config.hpp"
+
+namespace oxide {
+    class ThreadPool;
+
+namespace detail {
+    // The pool and worker index of the calling thread, if it is a pool worker
+    struct CurrentWorker {
+        const ThreadPool* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    inline thread_local CurrentWorker current_worker;
+
+    // Runs `f`, capturing an exception so the joining thread can rethrow it
+    template <typename F>
+    void invoke_capturing(F& f, std::exception_ptr& error) noexcept {
+#if defined(OXIDE_NO_EXCEPTIONS)
+        (void)error;
+        f();
+#else
+        try {
+            f();
+        } catch (...) {
+            error = std::current_exception();
+        }
+#endif
+    }
+
+    inline void rethrow_if(const std::exception_ptr& error) {
+#if !defined(OXIDE_NO_EXCEPTIONS)
+        if (error) {
+            std::rethrow_exception(error);
+        }
+#else
+        (void)error;
+#endif
+    }
+}  // namespace detail
+
+/// ============================================================================
+/// ThreadPool, a work-stealing fork-join pool
+/// ============================================================================
+    /**
+     * @brief A fork-join thread pool with one deque per worker. A worker pushes forked tasks to
+     *        the back of its own deque and pops them back LIFO, which keeps recently split data
+     *        hot in its cache; idle workers steal from the front of other deques, taking the
+     *        largest pending pieces first. Jobs submitted from outside go through a shared
+     *        injector queue. A thread waiting for a stolen task runs other pending tasks instead
+     *        of blocking. Backs Vec::par_iter() and Vec::par_iter_mut().
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @brief Starts a pool.
+         *
+         * @param threads The number of worker threads (at least one).
+         */
+        explicit ThreadPool(const std::size_t threads = default_threads())
+            : m_queues(std::max<std::size_t>(threads, 1) + 1) {
+            const std::size_t count = m_queues.size() - 1;
+            m_workers.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                m_workers.emplace_back([this, i] { worker_main(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Stops the workers once every queued job has run.
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard guard(m_sleep_lock);
+                m_stop = true;
+            }
+            m_sleep_cv.notify_all();
+            m_workers.clear();  // Joins
+        }
+
+        /**
+         * @brief The number of worker threads: the OXIDE_NUM_THREADS environment variable if set,
+         *        otherwise the hardware concurrency.
+         */
+        [[nodiscard]] static std::size_t default_threads() noexcept {
+            if (const char* env = std::getenv("OXIDE_NUM_THREADS")) {
+                if (const auto n = std::strtoul(env, nullptr, 10); n > 0) {
+                    return n;
+                }
+            }
+            return std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        /**
+         * @brief Returns the process-wide pool, started on first use with default_threads() workers.
+         */
+        [[nodiscard]] static ThreadPool& global() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        [[nodiscard]] std::size_t num_threads() const noexcept {
+            return m_queues.size() - 1;
+        }
+
+        /**
+         * @brief Returns the index of the calling worker of this pool, or num_threads() when the
+         *        caller is not one of its workers.
+         */
+        [[nodiscard]] std::size_t current_index() const noexcept {
+            return detail::current_worker.pool == this ? detail::current_worker.index : num_threads();
+        }
+
+        /**
+         * @brief Runs `f` on the pool and blocks until it returns. Called from one of the pool's
+         *        own workers, `f` simply runs inline. Exceptions thrown by `f` are rethrown here.
+         *
+         * @param f The function to run.
+         * @return Whatever `f` returns, by value.
+         */
+        template <typename F>
+        auto install(F&& f) {
+            using R = std::invoke_result_t<F&>;
+            if (detail::current_worker.pool == this) {
+                return f();
+            }
+            if constexpr (std::is_void_v<R>) {
+                InstallJob<std::remove_reference_t<F>> job(f);
+                push(num_threads(), &job);
+                job.wait();
+            } else {
+                std::optional<std::remove_cvref_t<R>> out;
+                install([&] { out.emplace(f()); });
+                return std::move(*out);
+            }
+        }
+
+        /**
+         * @brief Runs `a` and `b`, potentially in parallel, and returns once both have finished.
+         *        `b` is offered to idle workers while the caller runs `a`; if nobody took it, the
+         *        caller runs it too, so an unneeded fork costs one deque push and pop.
+         *        If either throws, the exception is rethrown after both have finished.
+         *
+         * @param a The task run by the caller.
+         * @param b The task offered for stealing.
+         */
+        template <typename A, typename B>
+        void join(A&& a, B&& b) {
+            if (detail::current_worker.pool != this) {
+                install([&] { join(a, b); });
+                return;
+            }
+            const std::size_t self = detail::current_worker.index;
+            JoinJob<std::remove_reference_t<B>> job_b(b);
+            push(self, &job_b);
+
+            std::exception_ptr error;
+            detail::invoke_capturing(a, error);
+
+            if (pop_if_back(self, &job_b)) {
+                job_b.run(&job_b);
+            } else {
+                // Stolen: help with other work until the thief is done
+                while (!job_b.done.load(std::memory_order_acquire)) {
+                    if (Job* other = find_work(self)) {
+                        other->run(other);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            detail::rethrow_if(error);
+            detail::rethrow_if(job_b.error);
+        }
+
+    private:
+        // A type-erased task; `run` signals completion as its very last access to the job
+        struct Job {
+            void (*run)(Job*);
+        };
+
+        template <typename F>
+        struct JoinJob : Job {
+            F* f;
+            std::exception_ptr error;
+            std::atomic<bool> done{false};
+
+            explicit JoinJob(F& fn) noexcept : Job{&execute}, f(&fn) {}
+
+            static void execute(Job* base) {
+                auto* self = static_cast<JoinJob*>(base);
+                detail::invoke_capturing(*self->f, self->error);
+                self->done.store(true, std::memory_order_release);
+            }
+        };
+
+        template <typename F>
+        struct InstallJob : Job {
+            F* f;
+            std::exception_ptr error;
+            std::mutex lock;
+            std::condition_variable cv;
+            bool done = false;
+
+            explicit InstallJob(F& fn) noexcept : Job{&execute}, f(&fn) {}
+
+            static void execute(Job* base) {
+                auto* self = static_cast<InstallJob*>(base);
+                detail::invoke_capturing(*self->f, self->error);
+                // Notify under the lock so the waiter cannot destroy the job before we let go of it
+                std::lock_guard guard(self->lock);
+                self->done = true;
+                self->cv.notify_one();
+            }
+
+            void wait() {
+                {
+                    std::unique_lock guard(lock);
+                    cv.wait(guard, [&] { return done; });
+                }
+                detail::rethrow_if(error);
+            }
+        };
+
+        struct alignas(64) Queue {
+            std::mutex lock;
+            std::deque<Job*> jobs;
+        };
+
+        std::vector<Queue> m_queues;  // One per worker, followed by the injector
+        std::atomic<std::size_t> m_queued{0};
+        std::atomic<std::size_t> m_sleeping{0};
+        std::mutex m_sleep_lock;
+        std::condition_variable m_sleep_cv;
+        bool m_stop = false;
+        std::vector<std::jthread> m_workers;  // Last, so workers start after everything above
+
+        void push(const std::size_t queue, Job* job) {
+            {
+                std::lock_guard guard(m_queues[queue].lock);
+                m_queues[queue].jobs.push_back(job);
+            }
+            m_queued.fetch_add(1);
+            if (m_sleeping.load() > 0) {
+                { std::lock_guard guard(m_sleep_lock); }
+                m_sleep_cv.notify_one();
+            }
+        }
+
+        // Pops `job` if it is still at the back of the worker's own deque, i.e. nobody stole it
+        bool pop_if_back(const std::size_t self, const Job* job) {
+            std::lock_guard guard(m_queues[self].lock);
+            auto& jobs = m_queues[self].jobs;
+            if (jobs.empty() || jobs.back() != job) {
+                return false;
+            }
+            jobs.pop_back();
+            m_queued.fetch_sub(1);
+            return true;
+        }
+
+        Job* find_work(const std::size_t self) {
+            {
+                std::lock_guard guard(m_queues[self].lock);
+                if (auto& own = m_queues[self].jobs; !own.empty()) {
+                    Job* job = own.back();
+                    own.pop_back();
+                    m_queued.fetch_sub(1);
+                    return job;
+                }
+            }
+            // Injector first, then the other workers, starting from our neighbour
+            const std::size_t workers = num_threads();
+            for (std::size_t k = 0; k < workers; ++k) {
+                const std::size_t victim = k == 0 ? workers : (self + k) % workers;
+                if (m_queued.load(std::memory_order_relaxed) == 0) {
+                    return nullptr;
+                }
+                std::lock_guard guard(m_queues[victim].lock);
+                if (auto& jobs = m_queues[victim].jobs; !jobs.empty()) {
+                    Job* job = jobs.front();
+                    jobs.pop_front();
+                    m_queued.fetch_sub(1);
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void worker_main(const std::size_t index) {
+            detail::current_worker = detail::CurrentWorker{this, index};
+            while (true) {
+                if (Job* job = find_work(index)) {
+                    job->run(job);
+                    continue;
+                }
+                std::unique_lock guard(m_sleep_lock);
+                m_sleeping.fetch_add(1);
+                m_sleep_cv.wait(guard, [&] { return m_stop || m_queued.load() > 0; });
+                m_sleeping.fetch_sub(1);
+                if (m_stop && m_queued.load() == 0) {
+                    return;
+                }
+            }
+        }
+    };
+
+namespace detail {
+    /**
+     * @brief Decides when a parallel range is split further, following the adaptive scheme used by
+     *        Rayon: start with one split per thread; every time a piece is stolen, the thief gets a
+     *        fresh budget of splits, so the work keeps dividing exactly where threads are idle and
+     *        uneven per-element costs even out without tuning.
+     */
+    struct Splitter {
+        std::size_t splits;
+        std::size_t min_len;
+
+        [[nodiscard]] bool try_split(const std::size_t len, const bool migrated, const std::size_t threads) noexcept {
+            if (len / 2 < min_len) {
+                return false;
+            }
+            if (migrated) {
+                splits = std::max(threads, splits / 2);
+                return true;
+            }
+            if (splits > 0) {
+                splits /= 2;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    /**
+     * @brief Recursively splits [begin, end) on the pool, calls `leaf(begin, end)` on every piece
+     *        and folds the pieces' results in order with `combine` (unused for void leaves). When
+     *        `stop` is set, the remaining pieces of a void leaf are skipped.
+     */
+    template <typename Leaf, typename Combine>
+    auto par_bridge(ThreadPool& pool, const std::size_t begin, const std::size_t end, Splitter splitter,
+                    const bool migrated, const Leaf& leaf, const Combine& combine,
+                    const std::atomic<bool>* stop) -> std::invoke_result_t<const Leaf&, std::size_t, std::size_t> {
+        using R = std::invoke_result_t<const Leaf&, std::size_t, std::size_t>;
+        if constexpr (std::is_void_v<R>) {
+            if (stop && stop->load(std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        if (!splitter.try_split(end - begin, migrated, pool.num_threads())) {
+            return leaf(begin, end);
+        }
+        const std::size_t mid = begin + (end - begin) / 2;
+        const std::size_t origin = pool.current_index();
+        if constexpr (std::is_void_v<R>) {
+            pool.join([&] { par_bridge(pool, begin, mid, splitter, false, leaf, combine, stop); },
+                      [&] { par_bridge(pool, mid, end, splitter, pool.current_index() != origin, leaf, combine, stop); });
+        } else {
+            std::optional<R> left;
+            std::optional<R> right;
+            pool.join([&] { left.emplace(par_bridge(pool, begin, mid, splitter, false, leaf, combine, stop)); },
+                      [&] { right.emplace(par_bridge(pool, mid, end, splitter, pool.current_index() != origin, leaf, combine, stop)); });
+            return combine(std::move(*left), std::move(*right));
+        }
+    }
+
+    /**
+     * @brief Calls `leaf(begin, end)` on adaptively split pieces of [0, n) on `pool`. Once `stop`
+     *        is set, pieces that have not started yet are skipped.
+     */
+    template <typename Leaf>
+    void par_for(ThreadPool& pool, const std::size_t n, const std::size_t min_len, const Leaf& leaf,
+                 const std::atomic<bool>* stop = nullptr) {
+        pool.install([&] {
+            par_bridge(pool, 0, n, Splitter{pool.num_threads(), std::max<std::size_t>(min_len, 1)},
+                       false, leaf, nullptr, stop);
+        });
+    }
+
+    /**
+     * @brief Like par_for(), but folds the pieces' results in order with `combine`.
+     */
+    template <typename Leaf, typename Combine>
+    auto par_reduce(ThreadPool& pool, const std::size_t n, const std::size_t min_len, const Leaf& leaf,
+                    const Combine& combine) {
+        return pool.install([&] {
+            return par_bridge(pool, 0, n, Splitter{pool.num_threads(), std::max<std::size_t>(min_len, 1)},
+                              false, leaf, combine, nullptr);
+        });
+    }
+}  // namespace detail
+}  // namespace oxide
+
+#endif // OXIDE_THREAD_POOL_HPP